@@ -1,6 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Characters/ActionRPGCharacter.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "Components/Skills/SkillComponent.h"
+#include "Components/Combat/ComboComponent.h"
+#include "Characters/CharacterSpatialSubsystem.h"
 
 AActionRPGCharacter::AActionRPGCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -8,10 +12,35 @@ AActionRPGCharacter::AActionRPGCharacter(const FObjectInitializer& ObjectInitial
 	// Base character class - can be used for NPCs and enemies
 	// Player-specific functionality is in ActionRPGPlayerCharacter
 	PrimaryActorTick.bCanEverTick = true;
+
+	// Create Attribute Component
+	AttributeComponent = CreateDefaultSubobject<UAttributeComponent>(TEXT("AttributeComponent"));
+
+	// Create Skill Component
+	SkillComponent = CreateDefaultSubobject<USkillComponent>(TEXT("SkillComponent"));
+
+	// Create Combo Component
+	ComboComponent = CreateDefaultSubobject<UComboComponent>(TEXT("ComboComponent"));
 }
 
 void AActionRPGCharacter::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Make this character visible to skill targeting queries
+	if (UCharacterSpatialSubsystem* Spatial = UCharacterSpatialSubsystem::Get(this))
+	{
+		Spatial->RegisterCharacter(this);
+	}
+}
+
+void AActionRPGCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCharacterSpatialSubsystem* Spatial = UCharacterSpatialSubsystem::Get(this))
+	{
+		Spatial->UnregisterCharacter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
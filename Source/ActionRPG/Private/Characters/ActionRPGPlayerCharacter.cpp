@@ -6,9 +6,11 @@
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/Inventory/InventoryComponent.h"
+#include "Components/Attributes/AttributeComponent.h"
 #include "Items/Core/ItemBase.h"
 #include "Items/Core/ItemDataAsset.h"
 #include "Items/Core/ItemTypes.h"
+#include "Data/ItemDatabase.h"
 #include "Engine/World.h"
 #include "Kismet/KismetMathLibrary.h"
 
@@ -56,6 +58,12 @@ AActionRPGPlayerCharacter::AActionRPGPlayerCharacter(const FObjectInitializer& O
 
 	// Create Inventory Component
 	InventoryComponent = CreateDefaultSubobject<UInventoryComponent>(TEXT("InventoryComponent"));
+
+	// Player starts wounded so health potions can be used right away
+	if (AttributeComponent)
+	{
+		AttributeComponent->HealthDefaults = FAttributeDefaults(100.0f, 50.0f, 0.0f, 0.0f);
+	}
 }
 
 void AActionRPGPlayerCharacter::BeginPlay()
@@ -81,8 +89,15 @@ void AActionRPGPlayerCharacter::BeginPlay()
 	}
 
 	// Initialize health
-	CurrentHealth = FMath::Clamp(CurrentHealth, 0.0f, MaxHealth);
-	UE_LOG(LogTemp, Log, TEXT("ActionRPGPlayerCharacter: Health initialized - %.1f/%.1f"), CurrentHealth, MaxHealth);
+	if (AttributeComponent)
+	{
+		UE_LOG(LogTemp, Log, TEXT("ActionRPGPlayerCharacter: Health initialized - %.1f/%.1f"), 
+			AttributeComponent->GetValue(EActionRPGAttribute::Health), AttributeComponent->GetMaxValue(EActionRPGAttribute::Health));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter: AttributeComponent is NULL!"));
+	}
 
 	// Bind to inventory item used event
 	if (InventoryComponent)
@@ -195,61 +210,47 @@ void AActionRPGPlayerCharacter::Heal(float HealAmount)
 		return;
 	}
 
-	float OldHealth = CurrentHealth;
-	CurrentHealth = FMath::Clamp(CurrentHealth + HealAmount, 0.0f, MaxHealth);
-	float ActualHeal = CurrentHealth - OldHealth;
+	if (!AttributeComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::Heal - AttributeComponent is NULL"));
+		return;
+	}
 
-	UE_LOG(LogTemp, Log, TEXT("ActionRPGPlayerCharacter::Heal - Healed %.1f health (%.1f -> %.1f/%.1f)"), 
-		ActualHeal, OldHealth, CurrentHealth, MaxHealth);
+	const float ActualHeal = AttributeComponent->ModifyValue(EActionRPGAttribute::Health, HealAmount);
+
+	UE_LOG(LogTemp, Log, TEXT("ActionRPGPlayerCharacter::Heal - Healed %.1f health (now %.1f/%.1f)"), 
+		ActualHeal, AttributeComponent->GetValue(EActionRPGAttribute::Health), AttributeComponent->GetMaxValue(EActionRPGAttribute::Health));
 }
 
-void AActionRPGPlayerCharacter::OnItemUsed(UItemBase* Item)
+bool AActionRPGPlayerCharacter::IsHealthAtMax() const
 {
-	UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - EVENT FIRED! Item: %s"), 
-		Item ? TEXT("Valid") : TEXT("NULL"));
+	return !AttributeComponent || AttributeComponent->IsAtMax(EActionRPGAttribute::Health);
+}
+
+float AActionRPGPlayerCharacter::GetHealthPercent() const
+{
+	return AttributeComponent ? AttributeComponent->GetPercent(EActionRPGAttribute::Health) : 0.0f;
+}
 
+void AActionRPGPlayerCharacter::OnItemUsed(UItemBase* Item)
+{
 	if (!Item || !Item->ItemData)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Item or ItemData is NULL"));
 		return;
 	}
 
-	FName ItemID = Item->ItemData->ItemID;
-	EItemType ItemType = Item->ItemData->Type;
-	FString ItemIDString = ItemID.ToString();
-	FString ItemNameString = Item->ItemData->ItemName.ToString();
-
-	UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Item used: %s (ID: %s, Type: %d, Current Health: %.1f/%.1f)"), 
-		*ItemNameString, *ItemIDString, (int32)ItemType, CurrentHealth, MaxHealth);
-
-	// Handle health potion - check ItemID (case-insensitive comparison)
-	FString ItemIDLower = ItemIDString.ToLower();
-	if (ItemIDLower == TEXT("healthpotion"))
+	// Dispatch the item's compiled effects by RuntimeIndex (no ItemID string comparisons)
+	UItemDatabase* ItemDB = UItemDatabase::Get(this);
+	if (!ItemDB)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Health potion detected!"));
-		
-		// Default healing amount (can be customized per item later)
-		float HealAmount = 25.0f; // Heal 25 health per potion
-		
-		// Check if health is already at max
-		if (IsHealthAtMax())
-		{
-			UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Health already at max (%.1f/%.1f), cannot use health potion"), 
-				CurrentHealth, MaxHealth);
-			return;
-		}
-
-		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Healing player for %.1f health (Current: %.1f/%.1f)"), 
-			HealAmount, CurrentHealth, MaxHealth);
-		
-		Heal(HealAmount);
-		
-		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Health potion used successfully! New health: %.1f/%.1f"), 
-			CurrentHealth, MaxHealth);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Log, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Item is not a health potion (ID: %s)"), *ItemIDString);
+		UE_LOG(LogTemp, Warning, TEXT("ActionRPGPlayerCharacter::OnItemUsed - ItemDatabase is NULL"));
+		return;
 	}
-	// Add other consumable types here as needed
+
+	const bool bApplied = ItemDB->GetEffectTable().Apply(Item->ItemData->RuntimeIndex, this);
+
+	UE_LOG(LogTemp, Log, TEXT("ActionRPGPlayerCharacter::OnItemUsed - Item used: %s (Effects applied: %s, Health: %.1f)"), 
+		*Item->ItemData->ItemName.ToString(), bApplied ? TEXT("YES") : TEXT("NO"),
+		AttributeComponent ? AttributeComponent->GetValue(EActionRPGAttribute::Health) : 0.0f);
 }
@@ -0,0 +1,141 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Characters/CharacterSpatialSubsystem.h"
+#include "Characters/ActionRPGCharacter.h"
+#include "Core/ActionRPGStats.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Character Spatial Query"), STAT_CharacterSpatialQuery, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Spatial Characters"), STAT_SpatialCharacters, STATGROUP_ActionRPG);
+
+UCharacterSpatialSubsystem* UCharacterSpatialSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UCharacterSpatialSubsystem>() : nullptr;
+}
+
+bool UCharacterSpatialSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCharacterSpatialSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid.SetCellSize(CellSize);
+
+	UE_LOG(LogTemp, Log, TEXT("CharacterSpatialSubsystem: Initialized (Cell size: %.0f)"), CellSize);
+}
+
+void UCharacterSpatialSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<AActionRPGCharacter>, FRegistration>& Pair : Registrations)
+	{
+		if (USceneComponent* RootComponent = Pair.Value.RootComponent.Get())
+		{
+			RootComponent->TransformUpdated.Remove(Pair.Value.TransformUpdatedHandle);
+		}
+	}
+
+	Registrations.Empty();
+	Grid.Reset();
+	MaxCharacterRadius = 0.0f;
+	SET_DWORD_STAT(STAT_SpatialCharacters, 0);
+
+	Super::Deinitialize();
+}
+
+void UCharacterSpatialSubsystem::RegisterCharacter(AActionRPGCharacter* Character)
+{
+	if (!Character || Registrations.Contains(Character))
+	{
+		return;
+	}
+
+	USceneComponent* RootComponent = Character->GetRootComponent();
+	if (!RootComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("CharacterSpatialSubsystem::RegisterCharacter - %s has no root component"), *Character->GetName());
+		return;
+	}
+
+	FRegistration& Registration = Registrations.Add(Character);
+	Registration.GridId = Grid.Add(Character, RootComponent->GetComponentLocation());
+	Registration.RootComponent = RootComponent;
+	Registration.TransformUpdatedHandle = RootComponent->TransformUpdated.AddUObject(
+		this, &UCharacterSpatialSubsystem::HandleTransformUpdated, Registration.GridId);
+
+	if (const UCapsuleComponent* Capsule = Character->GetCapsuleComponent())
+	{
+		MaxCharacterRadius = FMath::Max(MaxCharacterRadius, Capsule->GetScaledCapsuleRadius());
+	}
+
+	SET_DWORD_STAT(STAT_SpatialCharacters, Grid.Num());
+}
+
+void UCharacterSpatialSubsystem::UnregisterCharacter(AActionRPGCharacter* Character)
+{
+	FRegistration Registration;
+	if (!Registrations.RemoveAndCopyValue(Character, Registration))
+	{
+		return;
+	}
+
+	if (USceneComponent* RootComponent = Registration.RootComponent.Get())
+	{
+		RootComponent->TransformUpdated.Remove(Registration.TransformUpdatedHandle);
+	}
+
+	Grid.Remove(Registration.GridId);
+	SET_DWORD_STAT(STAT_SpatialCharacters, Grid.Num());
+}
+
+void UCharacterSpatialSubsystem::HandleTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 GridId)
+{
+	// O(1): position write, plus a cell swap only when a cell border is crossed
+	Grid.Update(GridId, UpdatedComponent->GetComponentLocation());
+}
+
+int32 UCharacterSpatialSubsystem::QueryRadius(const FVector& Center, float Radius, TArrayView<AActionRPGCharacter*> OutCharacters, const AActor* IgnoreActor) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_CharacterSpatialQuery);
+
+	return Grid.QueryRadius(Center, Radius, OutCharacters, [IgnoreActor](const AActionRPGCharacter* Character)
+	{
+		return Character != IgnoreActor;
+	});
+}
+
+int32 UCharacterSpatialSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees, TArrayView<AActionRPGCharacter*> OutCharacters, const AActor* IgnoreActor) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_CharacterSpatialQuery);
+
+	return Grid.QueryCone(Origin, Direction, Range, HalfAngleDegrees, OutCharacters, [IgnoreActor](const AActionRPGCharacter* Character)
+	{
+		return Character != IgnoreActor;
+	});
+}
+
+int32 UCharacterSpatialSubsystem::QueryLine(const FVector& Start, const FVector& End, float HalfWidth, TArrayView<AActionRPGCharacter*> OutCharacters, const AActor* IgnoreActor) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_CharacterSpatialQuery);
+
+	return Grid.QueryLine(Start, End, HalfWidth, OutCharacters, [IgnoreActor](const AActionRPGCharacter* Character)
+	{
+		return Character != IgnoreActor;
+	});
+}
+
+void UCharacterSpatialSubsystem::FindCharactersInRadius(FVector Center, float Radius, TArray<AActionRPGCharacter*>& OutCharacters, const AActor* IgnoreActor, int32 MaxResults) const
+{
+	OutCharacters.SetNumUninitialized(FMath::Max(MaxResults, 0));
+	OutCharacters.SetNum(QueryRadius(Center, Radius, OutCharacters, IgnoreActor));
+}
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Combat/ComboGraphDataAsset.h"
+
+UComboGraphDataAsset::UComboGraphDataAsset()
+{
+	// Set default values
+	bComboTableBuilt = false;
+}
+
+const FComboTable& UComboGraphDataAsset::GetComboTable()
+{
+	if (!bComboTableBuilt)
+	{
+		ComboTable.Build(*this);
+		bComboTableBuilt = true;
+	}
+
+	return ComboTable;
+}
+
+#if WITH_EDITOR
+void UComboGraphDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Rebuilt on next use
+	ComboTable.Reset();
+	bComboTableBuilt = false;
+}
+#endif
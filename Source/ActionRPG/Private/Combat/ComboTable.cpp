@@ -0,0 +1,135 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Combat/ComboTable.h"
+#include "Combat/ComboGraphDataAsset.h"
+#include "Animation/AnimMontage.h"
+
+void FComboTable::Reset()
+{
+	NumStates = 0;
+	NextStates.Reset();
+	WindowOpenTimes.Reset();
+	WindowCloseTimes.Reset();
+	Durations.Reset();
+	StateNames.Reset();
+	Montages.Reset();
+	MontageSections.Reset();
+	PlayRates.Reset();
+}
+
+void FComboTable::Build(const UComboGraphDataAsset& Graph)
+{
+	Reset();
+
+	NumStates = Graph.States.Num() + 1;
+	NextStates.Init(INDEX_NONE, NumStates * NumInputs);
+	WindowOpenTimes.Reserve(NumStates);
+	WindowCloseTimes.Reserve(NumStates);
+	Durations.Reserve(NumStates);
+	StateNames.Reserve(NumStates);
+	Montages.Reserve(NumStates);
+	MontageSections.Reserve(NumStates);
+	PlayRates.Reserve(NumStates);
+
+	// Entry state: always accepts input, never expires
+	WindowOpenTimes.Add(0.0f);
+	WindowCloseTimes.Add(MAX_flt);
+	Durations.Add(MAX_flt);
+	StateNames.Add(NAME_None);
+	Montages.Add(nullptr);
+	MontageSections.Add(NAME_None);
+	PlayRates.Add(1.0f);
+
+	TMap<FName, int32> StateLookup;
+	StateLookup.Reserve(Graph.States.Num());
+
+	for (const FComboStateDefinition& Definition : Graph.States)
+	{
+		const int32 State = StateNames.Num();
+		if (StateLookup.Contains(Definition.StateName))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("FComboTable::Build - %s: duplicate state %s"), *Graph.GetName(), *Definition.StateName.ToString());
+		}
+		else
+		{
+			StateLookup.Add(Definition.StateName, State);
+		}
+
+		const float PlayRate = FMath::Max(Definition.PlayRate, 0.01f);
+
+		float Duration = Definition.Duration;
+		if (Duration <= 0.0f && Definition.Montage)
+		{
+			Duration = Definition.Montage->GetPlayLength() / PlayRate;
+		}
+
+		WindowOpenTimes.Add(Definition.WindowOpen);
+		WindowCloseTimes.Add(FMath::Max(Definition.WindowClose, Definition.WindowOpen));
+		Durations.Add(FMath::Max(Duration, Definition.WindowClose));
+		StateNames.Add(Definition.StateName);
+		Montages.Add(Definition.Montage);
+		MontageSections.Add(Definition.MontageSection);
+		PlayRates.Add(PlayRate);
+	}
+
+	auto AddTransitions = [this, &Graph, &StateLookup](int32 FromState, const TArray<FComboTransitionDefinition>& Transitions)
+	{
+		for (const FComboTransitionDefinition& Transition : Transitions)
+		{
+			const int32* NextState = StateLookup.Find(Transition.NextState);
+			if (!NextState || Transition.Input == EComboInput::Count)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("FComboTable::Build - %s: transition from %s to unknown state %s"),
+					*Graph.GetName(), *StateNames[FromState].ToString(), *Transition.NextState.ToString());
+				continue;
+			}
+
+			NextStates[FromState * NumInputs + static_cast<int32>(Transition.Input)] = *NextState;
+		}
+	};
+
+	AddTransitions(EntryState, Graph.EntryTransitions);
+	for (int32 Index = 0; Index < Graph.States.Num(); ++Index)
+	{
+		AddTransitions(Index + 1, Graph.States[Index].Transitions);
+	}
+}
+
+EComboStep FComboTable::Evaluate(int32 State, float TimeInState, EComboInput Input, int32& OutNextState) const
+{
+	const int32 InputIndex = static_cast<int32>(Input);
+	if (IsEmpty() || InputIndex < 0 || InputIndex >= NumInputs)
+	{
+		return EComboStep::NoTransition;
+	}
+
+	// Finished (or invalid) states fall back to the entry state
+	if (!IsValidState(State) || TimeInState >= Durations[State])
+	{
+		State = EntryState;
+		TimeInState = 0.0f;
+	}
+
+	const int32 NextState = NextStates[State * NumInputs + InputIndex];
+	if (NextState != INDEX_NONE)
+	{
+		if (TimeInState < WindowOpenTimes[State])
+		{
+			return EComboStep::WindowNotOpen;
+		}
+
+		if (TimeInState <= WindowCloseTimes[State])
+		{
+			OutNextState = NextState;
+			return EComboStep::Advanced;
+		}
+	}
+
+	// Window missed (or no follow-up): the input can still start a chain once this state ends
+	if (State != EntryState && NextStates[EntryState * NumInputs + InputIndex] != INDEX_NONE)
+	{
+		return EComboStep::WindowNotOpen;
+	}
+
+	return EComboStep::NoTransition;
+}
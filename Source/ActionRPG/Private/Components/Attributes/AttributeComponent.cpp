@@ -0,0 +1,334 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/Attributes/AttributeComponent.h"
+#include "Characters/ActionRPGCharacter.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UAttributeComponent::UAttributeComponent()
+{
+	// Regen is evaluated lazily and notifications are deferred through the timer manager - no tick
+	PrimaryComponentTick.bCanEverTick = false;
+	bWantsInitializeComponent = true;
+
+	HealthDefaults = FAttributeDefaults(100.0f, 100.0f, 0.0f, 0.0f);
+	ManaDefaults = FAttributeDefaults(100.0f, 100.0f, 5.0f, 1.5f);
+	StaminaDefaults = FAttributeDefaults(100.0f, 100.0f, 15.0f, 1.0f);
+
+	ResetAttributes();
+}
+
+UAttributeComponent* UAttributeComponent::FindAttributeComponent(const AActor* Actor)
+{
+	if (const AActionRPGCharacter* Character = Cast<AActionRPGCharacter>(Actor))
+	{
+		return Character->AttributeComponent;
+	}
+
+	return Actor ? Actor->FindComponentByClass<UAttributeComponent>() : nullptr;
+}
+
+void UAttributeComponent::InitializeComponent()
+{
+	Super::InitializeComponent();
+
+	// Pick up defaults edited on the instance/Blueprint
+	ResetAttributes();
+}
+
+void UAttributeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+	bNotificationPending = false;
+	DirtyMask = 0;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+const FAttributeDefaults& UAttributeComponent::GetDefaults(EActionRPGAttribute Attribute) const
+{
+	switch (Attribute)
+	{
+	case EActionRPGAttribute::Mana:
+		return ManaDefaults;
+	case EActionRPGAttribute::Stamina:
+		return StaminaDefaults;
+	case EActionRPGAttribute::Health:
+	default:
+		return HealthDefaults;
+	}
+}
+
+double UAttributeComponent::GetAttributeTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UAttributeComponent::ResetAttributes()
+{
+	const double Now = GetAttributeTime();
+
+	Modifiers.Reset();
+	for (int32 Index = 0; Index < NumAttributes; Index++)
+	{
+		const EActionRPGAttribute Attribute = static_cast<EActionRPGAttribute>(Index);
+		const FAttributeDefaults& Defaults = GetDefaults(Attribute);
+
+		FAttributeState& State = States[Index];
+		State.BaseMax = FMath::Max(Defaults.MaxValue, 0.0f);
+		State.BaseRegen = Defaults.RegenPerSecond;
+		State.RegenDelay = Defaults.RegenDelay;
+		State.Max = State.BaseMax;
+		State.Regen = State.BaseRegen;
+		State.AnchorValue = FMath::Clamp(static_cast<double>(Defaults.InitialValue), 0.0, static_cast<double>(State.Max));
+		State.AnchorTime = Now;
+		State.RegenResumeTime = Now;
+	}
+}
+
+double UAttributeComponent::EvaluateValue(const FAttributeState& State, double Now)
+{
+	double Value = State.AnchorValue;
+
+	const double RegenFrom = FMath::Max(State.AnchorTime, State.RegenResumeTime);
+	if (State.Regen != 0.0f && Now > RegenFrom)
+	{
+		Value += static_cast<double>(State.Regen) * (Now - RegenFrom);
+	}
+
+	return FMath::Clamp(Value, 0.0, static_cast<double>(State.Max));
+}
+
+void UAttributeComponent::Rebase(FAttributeState& State, double Now)
+{
+	State.AnchorValue = EvaluateValue(State, Now);
+	State.AnchorTime = Now;
+}
+
+float UAttributeComponent::GetValue(EActionRPGAttribute Attribute) const
+{
+	if (!IsValidAttribute(Attribute))
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(EvaluateValue(States[static_cast<int32>(Attribute)], GetAttributeTime()));
+}
+
+float UAttributeComponent::GetMaxValue(EActionRPGAttribute Attribute) const
+{
+	return IsValidAttribute(Attribute) ? States[static_cast<int32>(Attribute)].Max : 0.0f;
+}
+
+float UAttributeComponent::GetRegenRate(EActionRPGAttribute Attribute) const
+{
+	return IsValidAttribute(Attribute) ? States[static_cast<int32>(Attribute)].Regen : 0.0f;
+}
+
+float UAttributeComponent::GetPercent(EActionRPGAttribute Attribute) const
+{
+	const float MaxValue = GetMaxValue(Attribute);
+	return MaxValue > 0.0f ? GetValue(Attribute) / MaxValue : 0.0f;
+}
+
+bool UAttributeComponent::IsAtMax(EActionRPGAttribute Attribute) const
+{
+	return GetValue(Attribute) >= GetMaxValue(Attribute);
+}
+
+float UAttributeComponent::ModifyValue(EActionRPGAttribute Attribute, float Delta)
+{
+	if (!IsValidAttribute(Attribute) || Delta == 0.0f)
+	{
+		return 0.0f;
+	}
+
+	const double Now = GetAttributeTime();
+	FAttributeState& State = States[static_cast<int32>(Attribute)];
+
+	const double OldValue = EvaluateValue(State, Now);
+	const double NewValue = FMath::Clamp(OldValue + Delta, 0.0, static_cast<double>(State.Max));
+
+	State.AnchorValue = NewValue;
+	State.AnchorTime = Now;
+	if (Delta < 0.0f && State.RegenDelay > 0.0f)
+	{
+		State.RegenResumeTime = Now + State.RegenDelay;
+	}
+
+	if (NewValue != OldValue)
+	{
+		MarkDirty(Attribute);
+	}
+
+	return static_cast<float>(NewValue - OldValue);
+}
+
+void UAttributeComponent::SetValue(EActionRPGAttribute Attribute, float NewValue)
+{
+	if (IsValidAttribute(Attribute))
+	{
+		ModifyValue(Attribute, NewValue - GetValue(Attribute));
+	}
+}
+
+void UAttributeComponent::ApplyServerValue(EActionRPGAttribute Attribute, float ServerValue)
+{
+	if (!IsValidAttribute(Attribute))
+	{
+		return;
+	}
+
+	const double Now = GetAttributeTime();
+	FAttributeState& State = States[static_cast<int32>(Attribute)];
+
+	const double OldValue = EvaluateValue(State, Now);
+	const double NewValue = FMath::Clamp(static_cast<double>(ServerValue), 0.0, static_cast<double>(State.Max));
+
+	State.AnchorValue = NewValue;
+	State.AnchorTime = Now;
+
+	if (NewValue != OldValue)
+	{
+		MarkDirty(Attribute);
+	}
+}
+
+bool UAttributeComponent::CanAfford(EActionRPGAttribute Attribute, float Cost) const
+{
+	return Cost <= 0.0f || GetValue(Attribute) >= Cost;
+}
+
+bool UAttributeComponent::Spend(EActionRPGAttribute Attribute, float Cost)
+{
+	if (!CanAfford(Attribute, Cost))
+	{
+		return false;
+	}
+
+	if (Cost > 0.0f)
+	{
+		ModifyValue(Attribute, -Cost);
+	}
+	return true;
+}
+
+FAttributeModifierHandle UAttributeComponent::AddModifier(EActionRPGAttribute Attribute, EAttributeModifierTarget Target, EAttributeModifierOp Op, float Magnitude)
+{
+	FAttributeModifierHandle Handle;
+	if (!IsValidAttribute(Attribute))
+	{
+		return Handle;
+	}
+
+	FAttributeModifier& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.ModifierID = NextModifierID++;
+	Modifier.Attribute = Attribute;
+	Modifier.Target = Target;
+	Modifier.Op = Op;
+	Modifier.Magnitude = Magnitude;
+
+	RecomputeModifiers(Attribute);
+
+	Handle.ModifierID = Modifier.ModifierID;
+	return Handle;
+}
+
+bool UAttributeComponent::RemoveModifier(FAttributeModifierHandle Handle)
+{
+	const int32 ModifierIndex = Modifiers.IndexOfByPredicate([&Handle](const FAttributeModifier& Modifier)
+	{
+		return Modifier.ModifierID == Handle.ModifierID;
+	});
+
+	if (ModifierIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const EActionRPGAttribute Attribute = Modifiers[ModifierIndex].Attribute;
+	Modifiers.RemoveAtSwap(ModifierIndex);
+	RecomputeModifiers(Attribute);
+	return true;
+}
+
+void UAttributeComponent::RecomputeModifiers(EActionRPGAttribute Attribute)
+{
+	FAttributeState& State = States[static_cast<int32>(Attribute)];
+
+	// Keep regen accrued under the old rate/max
+	Rebase(State, GetAttributeTime());
+
+	float MaxAdd = 0.0f;
+	float MaxMul = 0.0f;
+	float RegenAdd = 0.0f;
+	float RegenMul = 0.0f;
+
+	for (const FAttributeModifier& Modifier : Modifiers)
+	{
+		if (Modifier.Attribute != Attribute)
+		{
+			continue;
+		}
+
+		const bool bMax = Modifier.Target == EAttributeModifierTarget::MaxValue;
+		if (Modifier.Op == EAttributeModifierOp::Additive)
+		{
+			(bMax ? MaxAdd : RegenAdd) += Modifier.Magnitude;
+		}
+		else
+		{
+			(bMax ? MaxMul : RegenMul) += Modifier.Magnitude;
+		}
+	}
+
+	const float OldMax = State.Max;
+	State.Max = FMath::Max(0.0f, (State.BaseMax + MaxAdd) * (1.0f + MaxMul));
+	State.Regen = (State.BaseRegen + RegenAdd) * (1.0f + RegenMul);
+	State.AnchorValue = FMath::Min(State.AnchorValue, static_cast<double>(State.Max));
+
+	if (State.Max != OldMax)
+	{
+		MarkDirty(Attribute);
+	}
+}
+
+void UAttributeComponent::MarkDirty(EActionRPGAttribute Attribute)
+{
+	DirtyMask |= static_cast<uint8>(1u << static_cast<uint32>(Attribute));
+
+	if (bNotificationPending)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	bNotificationPending = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &UAttributeComponent::FlushNotifications);
+}
+
+void UAttributeComponent::FlushNotifications()
+{
+	bNotificationPending = false;
+
+	const uint8 ChangedMask = DirtyMask;
+	DirtyMask = 0;
+
+	for (int32 Index = 0; Index < NumAttributes; Index++)
+	{
+		if (ChangedMask & (1u << Index))
+		{
+			const EActionRPGAttribute Attribute = static_cast<EActionRPGAttribute>(Index);
+			OnAttributeChanged.Broadcast(Attribute, GetValue(Attribute), GetMaxValue(Attribute));
+		}
+	}
+}
@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/Combat/ComboComponent.h"
+#include "Combat/ComboGraphDataAsset.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+
+UComboComponent::UComboComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	CurrentState = FComboTable::EntryState;
+	StateEnterTime = 0.0;
+}
+
+void UComboComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Compile the graph now rather than on the first attack
+	SetComboGraph(ComboGraph);
+}
+
+void UComboComponent::SetComboGraph(UComboGraphDataAsset* NewComboGraph)
+{
+	ComboGraph = NewComboGraph;
+
+	// Builds the table if the asset hasn't yet
+	GetComboTable();
+	CurrentState = FComboTable::EntryState;
+}
+
+const FComboTable* UComboComponent::GetComboTable() const
+{
+	return ComboGraph ? &ComboGraph->GetComboTable() : nullptr;
+}
+
+EComboStep UComboComponent::HandleComboInput(EComboInput Input)
+{
+	const FComboTable* ComboTable = GetComboTable();
+	if (!ComboTable)
+	{
+		return EComboStep::NoTransition;
+	}
+
+	int32 NextState = INDEX_NONE;
+	const EComboStep Step = ComboTable->Evaluate(CurrentState, GetTimeInState(), Input, NextState);
+	if (Step == EComboStep::Advanced)
+	{
+		EnterState(*ComboTable, NextState);
+	}
+
+	return Step;
+}
+
+void UComboComponent::ResetCombo()
+{
+	if (CurrentState != FComboTable::EntryState)
+	{
+		CurrentState = FComboTable::EntryState;
+		OnComboStateChanged.Broadcast(NAME_None);
+	}
+}
+
+FName UComboComponent::GetComboStateName() const
+{
+	const FComboTable* ComboTable = GetComboTable();
+	if (!ComboTable || !ComboTable->IsValidState(CurrentState) || GetTimeInState() >= ComboTable->Durations[CurrentState])
+	{
+		return NAME_None;
+	}
+
+	return ComboTable->StateNames[CurrentState];
+}
+
+float UComboComponent::GetTimeInState() const
+{
+	const UWorld* World = GetWorld();
+	return World ? static_cast<float>(World->GetTimeSeconds() - StateEnterTime) : 0.0f;
+}
+
+void UComboComponent::EnterState(const FComboTable& ComboTable, int32 State)
+{
+	CurrentState = State;
+	if (const UWorld* World = GetWorld())
+	{
+		StateEnterTime = World->GetTimeSeconds();
+	}
+
+	if (UAnimMontage* Montage = ComboTable.Montages[State])
+	{
+		if (ACharacter* Character = Cast<ACharacter>(GetOwner()))
+		{
+			Character->PlayAnimMontage(Montage, ComboTable.PlayRates[State], ComboTable.MontageSections[State]);
+		}
+	}
+
+	OnComboStateChanged.Broadcast(ComboTable.StateNames[State]);
+}
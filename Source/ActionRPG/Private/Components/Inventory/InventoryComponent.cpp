@@ -4,8 +4,14 @@
 #include "Items/Core/ItemBase.h"
 #include "Items/Core/ItemDataAsset.h"
 #include "Items/Core/ItemTypes.h"
+#include "Items/Core/ItemInstancePool.h"
 #include "Items/Pickups/ItemPickupActor.h"
+#include "Items/Pickups/PickupActorPool.h"
+#include "Items/Pickups/WorldItemSubsystem.h"
+#include "Items/Pickups/LootLifetimeSubsystem.h"
 #include "Characters/ActionRPGPlayerCharacter.h"
+#include "Data/ItemDatabase.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
 #include "Engine/World.h"
 
 UInventoryComponent::UInventoryComponent()
@@ -123,20 +129,16 @@ bool UInventoryComponent::AddItem(UItemBase* Item, int32 Quantity)
 
 		UE_LOG(LogTemp, Log, TEXT("InventoryComponent::AddItem - Creating new item instance for slot %d (StackSize: %d)"), EmptySlot, StackSize);
 
-		// Create new item instance for this slot
-		// Use component as outer - component owns inventory items
-		// This ensures items are not garbage collected while component exists
-		UItemBase* NewItem = NewObject<UItemBase>(this, UItemBase::StaticClass());
+		// Acquire item instance for this slot from the world's item pool
+		// The slot's TObjectPtr keeps it referenced while it is in the inventory
+		UItemBase* NewItem = AcquireItemInstance(Item->ItemData, StackSize);
 		if (!NewItem)
 		{
 			UE_LOG(LogTemp, Error, TEXT("InventoryComponent::AddItem - Failed to create new item instance"));
 			return false;
 		}
 
-		NewItem->ItemData = Item->ItemData;
-		NewItem->Quantity = StackSize;
-
-		UE_LOG(LogTemp, Log, TEXT("InventoryComponent::AddItem - Item instance created: %s (Quantity: %d, ItemData: %s, Outer: Component)"),
+		UE_LOG(LogTemp, Log, TEXT("InventoryComponent::AddItem - Item instance acquired: %s (Quantity: %d, ItemData: %s)"),
 			NewItem ? TEXT("Valid") : TEXT("nullptr"),
 			NewItem ? NewItem->Quantity : 0,
 			NewItem && NewItem->ItemData ? *NewItem->ItemData->ItemName.ToString() : TEXT("nullptr"));
@@ -199,6 +201,143 @@ bool UInventoryComponent::AddItem(UItemBase* Item, int32 Quantity)
 	return true;
 }
 
+int32 UInventoryComponent::AddItemsBulk(TConstArrayView<FInventoryAddRequest> Requests, TArray<bool>& OutAccepted)
+{
+	OutAccepted.Init(false, Requests.Num());
+
+	// Counted once for the whole batch and kept current as requests are committed
+	float CurrentWeight = GetCurrentWeight();
+	int32 EmptySlots = GetEmptySlotCount();
+	int32 NextEmptySearch = 0;
+
+	TArray<int32, TInlineAllocator<16>> ChangedSlots;
+	int32 NumAccepted = 0;
+
+	for (int32 RequestIndex = 0; RequestIndex < Requests.Num(); RequestIndex++)
+	{
+		const FInventoryAddRequest& Request = Requests[RequestIndex];
+		UItemDataAsset* ItemData = Request.ItemData;
+		if (!ItemData || Request.Quantity <= 0)
+		{
+			continue;
+		}
+
+		const int32 MaxStackSize = FMath::Max(ItemData->MaxStackSize, 1);
+		const float RequestWeight = ItemData->Weight * Request.Quantity;
+		if (CurrentWeight + RequestWeight > MaxWeight)
+		{
+			continue;
+		}
+
+		// Whole request must fit: room left on existing stacks plus full stacks in empty slots
+		int32 StackSpace = 0;
+		for (const FInventorySlot& Slot : InventorySlots)
+		{
+			if (!Slot.bIsEmpty && Slot.Item && Slot.Item->ItemData && Slot.Item->ItemData->ItemID == ItemData->ItemID)
+			{
+				StackSpace += FMath::Max(MaxStackSize - Slot.Quantity, 0);
+			}
+		}
+
+		const int32 NewSlotsNeeded = FMath::DivideAndRoundUp(FMath::Max(Request.Quantity - StackSpace, 0), MaxStackSize);
+		if (NewSlotsNeeded > EmptySlots)
+		{
+			continue;
+		}
+
+		// Commit - existing stacks first, then new slots. Each touched slot's previous quantity is
+		// kept so a request that can't be placed after all is undone rather than left half-added.
+		TArray<TPair<int32, int32>, TInlineAllocator<8>> PreviousQuantities;
+		const int32 NumChangedBefore = ChangedSlots.Num();
+		int32 RemainingQuantity = Request.Quantity;
+		for (int32 SlotIndex = 0; SlotIndex < InventorySlots.Num() && RemainingQuantity > 0; SlotIndex++)
+		{
+			FInventorySlot& Slot = InventorySlots[SlotIndex];
+			if (Slot.bIsEmpty || !Slot.Item || !Slot.Item->ItemData || Slot.Item->ItemData->ItemID != ItemData->ItemID || Slot.Quantity >= MaxStackSize)
+			{
+				continue;
+			}
+
+			const int32 StackAmount = FMath::Min(MaxStackSize - Slot.Quantity, RemainingQuantity);
+			PreviousQuantities.Emplace(SlotIndex, Slot.Quantity);
+			Slot.Quantity += StackAmount;
+			Slot.Item->Quantity = Slot.Quantity;
+			RemainingQuantity -= StackAmount;
+			ChangedSlots.AddUnique(SlotIndex);
+		}
+
+		while (RemainingQuantity > 0)
+		{
+			while (NextEmptySearch < InventorySlots.Num() && !InventorySlots[NextEmptySearch].bIsEmpty)
+			{
+				NextEmptySearch++;
+			}
+
+			const int32 StackSize = FMath::Min(RemainingQuantity, MaxStackSize);
+			UItemBase* NewItem = InventorySlots.IsValidIndex(NextEmptySearch) ? AcquireItemInstance(ItemData, StackSize) : nullptr;
+			if (!NewItem)
+			{
+				UE_LOG(LogTemp, Error, TEXT("InventoryComponent::AddItemsBulk - Failed to place %s (Remaining: %d)"),
+					*ItemData->ItemName.ToString(), RemainingQuantity);
+				break;
+			}
+
+			FInventorySlot& Slot = InventorySlots[NextEmptySearch];
+			PreviousQuantities.Emplace(NextEmptySearch, 0);
+			Slot.Item = NewItem;
+			Slot.Quantity = StackSize;
+			Slot.bIsEmpty = false;
+			ChangedSlots.AddUnique(NextEmptySearch);
+			EmptySlots--;
+			RemainingQuantity -= StackSize;
+		}
+
+		if (RemainingQuantity > 0)
+		{
+			for (const TPair<int32, int32>& Previous : PreviousQuantities)
+			{
+				FInventorySlot& Slot = InventorySlots[Previous.Key];
+				if (Previous.Value == 0)
+				{
+					ReleaseItemInstance(Slot.Item);
+					Slot.Item = nullptr;
+					Slot.Quantity = 0;
+					Slot.bIsEmpty = true;
+					EmptySlots++;
+					NextEmptySearch = FMath::Min(NextEmptySearch, Previous.Key);
+				}
+				else
+				{
+					Slot.Quantity = Previous.Value;
+					Slot.Item->Quantity = Previous.Value;
+				}
+			}
+
+			// Slots first touched by this request are back to how they were
+			ChangedSlots.SetNum(NumChangedBefore, EAllowShrinking::No);
+			continue;
+		}
+
+		CurrentWeight += RequestWeight;
+		OutAccepted[RequestIndex] = true;
+		NumAccepted++;
+	}
+
+	if (ChangedSlots.Num() > 0)
+	{
+		for (const int32 SlotIndex : ChangedSlots)
+		{
+			UpdateSlotEmptyStatus(SlotIndex);
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("InventoryComponent::AddItemsBulk - Added %d of %d requests (%d slots changed)"),
+			NumAccepted, Requests.Num(), ChangedSlots.Num());
+		OnInventoryBulkChanged.Broadcast(TArray<int32>(ChangedSlots));
+	}
+
+	return NumAccepted;
+}
+
 bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity)
 {
 	if (!InventorySlots.IsValidIndex(SlotIndex))
@@ -219,7 +358,8 @@ bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity)
 
 	Slot.Quantity -= RemoveQuantity;
 
-	if (Slot.Quantity <= 0)
+	const bool bSlotEmptied = Slot.Quantity <= 0;
+	if (bSlotEmptied)
 	{
 		// Slot is now empty
 		Slot.Item = nullptr;
@@ -243,6 +383,12 @@ bool UInventoryComponent::RemoveItem(int32 SlotIndex, int32 Quantity)
 	UE_LOG(LogTemp, Log, TEXT("InventoryComponent::RemoveItem - Removed %d of %s from slot %d"), 
 		RemoveQuantity, Item ? *Item->ItemData->ItemName.ToString() : TEXT("NULL"), SlotIndex);
 
+	// Stack emptied - return the instance to the pool (after listeners have seen it)
+	if (bSlotEmptied)
+	{
+		ReleaseItemInstance(Item);
+	}
+
 	return true;
 }
 
@@ -292,12 +438,18 @@ bool UInventoryComponent::MoveItem(int32 FromSlot, int32 ToSlot)
 			{
 				int32 StackAmount = FMath::Min(AvailableSpace, FromSlotRef.Quantity);
 				ToSlotRef.Quantity += StackAmount;
+				ToSlotRef.Item->Quantity = ToSlotRef.Quantity;
 				FromSlotRef.Quantity -= StackAmount;
 
 				if (FromSlotRef.Quantity <= 0)
 				{
+					ReleaseItemInstance(FromSlotRef.Item);
 					FromSlotRef = FInventorySlot(); // Clear source slot
 				}
+				else
+				{
+					FromSlotRef.Item->Quantity = FromSlotRef.Quantity;
+				}
 
 				BroadcastInventoryChanged(FromSlot, FromSlotRef.Item);
 				BroadcastInventoryChanged(ToSlot, ToSlotRef.Item);
@@ -373,24 +525,27 @@ bool UInventoryComponent::UseItem(int32 SlotIndex)
 		return false;
 	}
 
-	// Get item ID for type-specific validation
-	FName ItemID = Slot.Item->ItemData->ItemID;
+	// Data-driven effect validation (e.g. health potions cannot be used at full health)
+	if (UItemDatabase* ItemDB = UItemDatabase::Get(this))
+	{
+		if (!ItemDB->GetEffectTable().CanApply(Slot.Item->ItemData->RuntimeIndex, GetOwner()))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("InventoryComponent::UseItem - Item effects would have no effect on owner: %s"), 
+				*Slot.Item->ItemData->ItemName.ToString());
+			return false;
+		}
+	}
 
-	// Special validation for health potions - check if player health is at max
-	if (ItemID == FName("HealthPotion") || ItemID == FName("healthpotion"))
+	// Consumable cooldowns (shared per CooldownGroup, e.g. all potions)
+	USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this);
+	if (Cooldowns)
 	{
-		// Get the owner (should be the player character)
-		if (AActor* Owner = GetOwner())
+		const float CooldownRemaining = Cooldowns->GetItemCooldownRemaining(GetOwner(), Slot.Item->ItemData);
+		if (CooldownRemaining > 0.0f)
 		{
-			if (AActionRPGPlayerCharacter* PlayerCharacter = Cast<AActionRPGPlayerCharacter>(Owner))
-			{
-				if (PlayerCharacter->IsHealthAtMax())
-				{
-					UE_LOG(LogTemp, Warning, TEXT("InventoryComponent::UseItem - Cannot use health potion: Health already at max (%.1f/%.1f)"), 
-						PlayerCharacter->CurrentHealth, PlayerCharacter->MaxHealth);
-					return false;
-				}
-			}
+			UE_LOG(LogTemp, Log, TEXT("InventoryComponent::UseItem - %s is on cooldown (%.2fs remaining)"), 
+				*Slot.Item->ItemData->ItemName.ToString(), CooldownRemaining);
+			return false;
 		}
 	}
 
@@ -440,6 +595,12 @@ bool UInventoryComponent::UseItem(int32 SlotIndex)
 		break;
 	}
 
+	// Start the item's cooldown before using it (the slot may be emptied below)
+	if (Cooldowns)
+	{
+		Cooldowns->CommitItemCooldown(GetOwner(), *Slot.Item->ItemData);
+	}
+
 	// Use the item (calls ItemBase::Use() which broadcasts OnItemUsed)
 	Slot.Item->Use();
 
@@ -698,6 +859,33 @@ void UInventoryComponent::BroadcastInventoryChanged(int32 SlotIndex, UItemBase*
 }
 
 
+UItemBase* UInventoryComponent::AcquireItemInstance(UItemDataAsset* ItemData, int32 Quantity)
+{
+	if (UItemInstancePool* Pool = UItemInstancePool::Get(this))
+	{
+		return Pool->Acquire(ItemData, Quantity);
+	}
+
+	// No pool (e.g. editor preview world) - component owns the instance
+	UItemBase* NewItem = NewObject<UItemBase>(this, UItemBase::StaticClass());
+	NewItem->ItemData = ItemData;
+	NewItem->Quantity = FMath::Max(1, Quantity);
+	return NewItem;
+}
+
+void UInventoryComponent::ReleaseItemInstance(UItemBase* Item)
+{
+	if (!Item)
+	{
+		return;
+	}
+
+	if (UItemInstancePool* Pool = UItemInstancePool::Get(this))
+	{
+		Pool->Release(Item);
+	}
+}
+
 void UInventoryComponent::ReportInventoryContents() const
 {
 	UE_LOG(LogTemp, Warning, TEXT("========================================"));
@@ -804,18 +992,14 @@ bool UInventoryComponent::SplitStack(int32 SlotIndex, int32 SplitQuantity)
 		return false;
 	}
 
-	// Create new item instance with split quantity
-	UItemBase* NewItem = NewObject<UItemBase>(this, UItemBase::StaticClass());
+	// Acquire new item instance with split quantity
+	UItemBase* NewItem = AcquireItemInstance(Slot.Item->ItemData, SplitQuantity);
 	if (!NewItem)
 	{
 		UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::SplitStack - Failed to create new item instance"));
 		return false;
 	}
 
-	// Initialize new item with same data
-	NewItem->ItemData = Slot.Item->ItemData;
-	NewItem->Quantity = SplitQuantity;
-
 	// Update source slot (reduce quantity)
 	Slot.Quantity -= SplitQuantity;
 	if (Slot.Quantity <= 0)
@@ -900,18 +1084,14 @@ bool UInventoryComponent::SplitStackToSlot(int32 SourceSlotIndex, int32 TargetSl
 	if (TargetSlot.bIsEmpty)
 	{
 		// Target slot is empty - create split stack directly in target slot
-		// Create new item instance with split quantity
-		UItemBase* NewItem = NewObject<UItemBase>(this, UItemBase::StaticClass());
+		// Acquire new item instance with split quantity
+		UItemBase* NewItem = AcquireItemInstance(SourceSlot.Item->ItemData, SplitQuantity);
 		if (!NewItem)
 		{
 			UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::SplitStackToSlot - Failed to create new item instance"));
 			return false;
 		}
 
-		// Initialize new item with same data
-		NewItem->ItemData = SourceSlot.Item->ItemData;
-		NewItem->Quantity = SplitQuantity;
-
 		// Update source slot (reduce quantity)
 		SourceSlot.Quantity -= SplitQuantity;
 		if (SourceSlot.Quantity <= 0)
@@ -964,6 +1144,7 @@ bool UInventoryComponent::SplitStackToSlot(int32 SourceSlotIndex, int32 TargetSl
 		SourceSlot.Quantity -= StackAmount;
 		if (SourceSlot.Quantity <= 0)
 		{
+			ReleaseItemInstance(SourceSlot.Item);
 			SourceSlot.Item = nullptr;
 			SourceSlot.bIsEmpty = true;
 			SourceSlot.Quantity = 0;
@@ -1022,6 +1203,13 @@ bool UInventoryComponent::DropItemToWorld(int32 SlotIndex, int32 Quantity, const
 		return false;
 	}
 
+	// Dropped pickups replicate from the server; a client can't create them
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UInventoryComponent::DropItemToWorld - Owner has no authority"));
+		return false;
+	}
+
 	// Get item data
 	if (!Slot.Item->ItemData)
 	{
@@ -1031,101 +1219,166 @@ bool UInventoryComponent::DropItemToWorld(int32 SlotIndex, int32 Quantity, const
 
 	const UItemDataAsset* ItemData = Slot.Item->ItemData;
 
-	// Determine which class to spawn: Blueprint class from DataAsset if specified, otherwise base class
-	TSubclassOf<AItemPickupActor> PickupActorClass = ItemData->ItemPickupActorClass;
-	if (!PickupActorClass)
-	{
-		// Fallback to base C++ class if no Blueprint class is specified
-		PickupActorClass = AItemPickupActor::StaticClass();
-		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - No Blueprint class specified in ItemDataAsset, using base AItemPickupActor class"));
-	}
-	else
+	// Top up piles of the same item already on the ground nearby; only the rest becomes a new drop
+	UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this);
+	const int32 MergedQuantity = WorldItems ? WorldItems->MergeIntoNearbyPiles(ItemData, Quantity, WorldLocation, GetOwner()) : 0;
+	const int32 DropQuantity = Quantity - MergedQuantity;
+
+	// Take what left the inventory out of the slot and fire events. Quantity merged into piles is on
+	// the ground already, so it is removed even if placing the remainder fails below.
+	auto RemoveDroppedQuantity = [this, SlotIndex, ItemData, &WorldLocation](int32 RemovedQuantity)
 	{
-		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Using Blueprint class: %s"), *PickupActorClass->GetName());
-	}
+		FInventorySlot& DropSlot = InventorySlots[SlotIndex];
+		UItemBase* RemovedItem = DropSlot.Item;
+		const bool bSlotEmptied = RemovedQuantity >= DropSlot.Quantity;
+		if (bSlotEmptied)
+		{
+			// Remove entire stack
+			DropSlot.Item = nullptr;
+			DropSlot.Quantity = 0;
+			DropSlot.bIsEmpty = true;
+		}
+		else
+		{
+			// Reduce quantity
+			DropSlot.Quantity -= RemovedQuantity;
+			DropSlot.Item->Quantity = DropSlot.Quantity;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Dropped %d of %s at location (%.2f, %.2f, %.2f)"), 
+			RemovedQuantity, *ItemData->ItemName.ToString(), WorldLocation.X, WorldLocation.Y, WorldLocation.Z);
+
+		// Clear quick-use slots referencing this inventory slot
+		for (int32 i = 0; i < QuickUseSlots.Num(); i++)
+		{
+			if (QuickUseSlots[i].InventorySlotIndex == SlotIndex)
+			{
+				ClearQuickUseSlot(i);
+			}
+		}
+
+		// Fire events
+		BroadcastInventoryChanged(SlotIndex, DropSlot.Item);
+		OnItemRemoved.Broadcast(RemovedItem, RemovedQuantity);
 
-	// Spawn ItemPickupActor at drop location using the specified class (Blueprint or base class)
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+		// Whole stack left the inventory - return the instance to the pool
+		if (bSlotEmptied)
+		{
+			ReleaseItemInstance(RemovedItem);
+		}
+	};
 
-	AItemPickupActor* PickupActor = World->SpawnActor<AItemPickupActor>(PickupActorClass, WorldLocation, FRotator::ZeroRotator, SpawnParams);
-	if (!PickupActor)
+	// Failing to place the remainder still removes what was merged
+	auto FailDrop = [&RemoveDroppedQuantity, MergedQuantity]()
 	{
-		UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::DropItemToWorld - Failed to spawn ItemPickupActor (Class: %s)"), 
-			PickupActorClass ? *PickupActorClass->GetName() : TEXT("NULL"));
+		if (MergedQuantity > 0)
+		{
+			RemoveDroppedQuantity(MergedQuantity);
+		}
 		return false;
-	}
+	};
 
-	// Set item data and quantity BEFORE removing from inventory (to ensure actor is properly set up)
-	UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Preparing to set item data: %s (Quantity: %d)"), 
-		ItemData ? *ItemData->ItemName.ToString() : TEXT("NULL"), Quantity);
-	
-	if (!ItemData)
+	// Items with a WorldMesh are stored as data and drawn instanced - no actor until someone interacts
+	const bool bStoredAsData = DropQuantity > 0 && WorldItems
+		&& WorldItems->AddWorldItem(const_cast<UItemDataAsset*>(ItemData), DropQuantity, FTransform(WorldLocation), GetOwner()) != INDEX_NONE;
+
+	if (DropQuantity > 0 && !bStoredAsData)
 	{
-		UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::DropItemToWorld - ItemData is NULL! Cannot drop item."));
-		PickupActor->Destroy();
-		return false;
-	}
+		// Determine which class to spawn: Blueprint class from DataAsset if specified, otherwise base class
+		TSubclassOf<AItemPickupActor> PickupActorClass = ItemData->ItemPickupActorClass;
+		if (!PickupActorClass)
+		{
+			// Fallback to base C++ class if no Blueprint class is specified
+			PickupActorClass = AItemPickupActor::StaticClass();
+			UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - No Blueprint class specified in ItemDataAsset, using base AItemPickupActor class"));
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Using Blueprint class: %s"), *PickupActorClass->GetName());
+		}
+
+		// Get an ItemPickupActor of the specified class (Blueprint or base class) at the drop location,
+		// reusing a pooled one when available
+		UPickupActorPool* PickupPool = UPickupActorPool::Get(this);
+		AItemPickupActor* PickupActor = nullptr;
+		if (PickupPool)
+		{
+			PickupActor = PickupPool->AcquirePickup(PickupActorClass, WorldLocation);
+		}
+		else
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+			PickupActor = World->SpawnActor<AItemPickupActor>(PickupActorClass, WorldLocation, FRotator::ZeroRotator, SpawnParams);
+		}
+
+		// Failed drops hand the actor back instead of destroying it
+		auto DiscardPickupActor = [PickupPool](AItemPickupActor* Actor)
+		{
+			if (PickupPool)
+			{
+				PickupPool->ReleasePickup(Actor);
+			}
+			else
+			{
+				Actor->Destroy();
+			}
+		};
+
+		if (!PickupActor)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::DropItemToWorld - Failed to spawn ItemPickupActor (Class: %s)"), 
+				PickupActorClass ? *PickupActorClass->GetName() : TEXT("NULL"));
+			return FailDrop();
+		}
+
+		// Set item data and quantity BEFORE removing from inventory (to ensure actor is properly set up)
+		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Preparing to set item data: %s (Quantity: %d)"), 
+			ItemData ? *ItemData->ItemName.ToString() : TEXT("NULL"), DropQuantity);
 	
-	UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Calling SetItemData with ItemData: %s (Pointer: %p)"), 
-		*ItemData->ItemName.ToString(), ItemData);
-	PickupActor->SetItemData(const_cast<UItemDataAsset*>(ItemData));
+		if (!ItemData)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::DropItemToWorld - ItemData is NULL! Cannot drop item."));
+			DiscardPickupActor(PickupActor);
+			return FailDrop();
+		}
 	
-	// Verify ItemData was set correctly
-	UItemDataAsset* SetItemDataResult = PickupActor->GetItemData();
-	if (!SetItemDataResult)
-	{
-		UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::DropItemToWorld - FAILED: SetItemData returned NULL! ItemData was not set on PickupActor."));
-		PickupActor->Destroy();
-		return false;
-	}
-	UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Verified: ItemData was set successfully: %s"), 
-		*SetItemDataResult->ItemName.ToString());
+		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Calling SetItemData with ItemData: %s (Pointer: %p)"), 
+			*ItemData->ItemName.ToString(), ItemData);
+		PickupActor->SetItemData(const_cast<UItemDataAsset*>(ItemData));
 	
-	UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Calling SetQuantity with Quantity: %d"), Quantity);
-	PickupActor->SetQuantity(Quantity);
+		// Verify ItemData was set correctly
+		UItemDataAsset* SetItemDataResult = PickupActor->GetItemData();
+		if (!SetItemDataResult)
+		{
+			UE_LOG(LogTemp, Error, TEXT("UInventoryComponent::DropItemToWorld - FAILED: SetItemData returned NULL! ItemData was not set on PickupActor."));
+			DiscardPickupActor(PickupActor);
+			return FailDrop();
+		}
+		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Verified: ItemData was set successfully: %s"), 
+			*SetItemDataResult->ItemName.ToString());
 	
-	// Verify Quantity was set correctly
-	int32 SetQuantityResult = PickupActor->GetQuantity();
-	if (SetQuantityResult != Quantity)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("UInventoryComponent::DropItemToWorld - Quantity mismatch: Expected %d, Got %d"), Quantity, SetQuantityResult);
-	}
+		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Calling SetQuantity with Quantity: %d"), DropQuantity);
+		PickupActor->SetQuantity(DropQuantity);
 	
-	UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - SetItemData and SetQuantity calls completed successfully"));
-
-	// Remove item from inventory AFTER ensuring actor is set up correctly
-	UItemBase* RemovedItem = Slot.Item;
-	if (Quantity >= Slot.Quantity)
-	{
-		// Remove entire stack
-		Slot.Item = nullptr;
-		Slot.Quantity = 0;
-		Slot.bIsEmpty = true;
-	}
-	else
-	{
-		// Reduce quantity
-		Slot.Quantity -= Quantity;
-		Slot.Item->Quantity = Slot.Quantity;
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - Dropped %d of %s at location (%.2f, %.2f, %.2f)"), 
-		Quantity, *ItemData->ItemName.ToString(), WorldLocation.X, WorldLocation.Y, WorldLocation.Z);
+		// Verify Quantity was set correctly
+		int32 SetQuantityResult = PickupActor->GetQuantity();
+		if (SetQuantityResult != DropQuantity)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("UInventoryComponent::DropItemToWorld - Quantity mismatch: Expected %d, Got %d"), DropQuantity, SetQuantityResult);
+		}
 
-	// Clear quick-use slots referencing this inventory slot
-	for (int32 i = 0; i < QuickUseSlots.Num(); i++)
-	{
-		if (QuickUseSlots[i].InventorySlotIndex == SlotIndex)
+		// Start the despawn clock; the dropper owns the loot for its rarity's ownership window
+		if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
 		{
-			ClearQuickUseSlot(i);
+			LootLifetime->TrackPickup(*PickupActor, GetOwner());
 		}
+	
+		UE_LOG(LogTemp, Log, TEXT("UInventoryComponent::DropItemToWorld - SetItemData and SetQuantity calls completed successfully"));
 	}
 
-	// Fire events
-	BroadcastInventoryChanged(SlotIndex, Slot.Item);
-	OnItemRemoved.Broadcast(RemovedItem, Quantity);
-
+	// Remove item from inventory AFTER ensuring actor is set up correctly
+	RemoveDroppedQuantity(Quantity);
 	return true;
 }
 
@@ -0,0 +1,393 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Components/Skills/SkillComponent.h"
+#include "Skills/Core/SkillActivation.h"
+#include "Skills/Core/SkillDataAsset.h"
+#include "Skills/Casting/SkillCastSubsystem.h"
+#include "Data/SkillDatabase.h"
+#include "Data/ActionRPGDataSubsystem.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "GameFramework/Actor.h"
+#include "Net/UnrealNetwork.h"
+
+USkillComponent::USkillComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+void USkillComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Everyone needs the slot layout: the owner to predict, other clients to resolve cosmetic slot indices
+	DOREPLIFETIME(USkillComponent, SlotSkillIDs);
+}
+
+void USkillComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (GetOwner() && GetOwner()->HasAuthority())
+	{
+		SlotSkillIDs = DefaultSkillIDs;
+		SlotSkillIDs.SetNum(NumSkillSlots);
+	}
+
+	RebuildLoadout();
+}
+
+void USkillComponent::HandleDataReady()
+{
+	RebuildLoadout();
+}
+
+void USkillComponent::OnRep_SlotSkillIDs()
+{
+	RebuildLoadout();
+}
+
+void USkillComponent::RebuildLoadout()
+{
+	USkillDatabase* SkillDB = USkillDatabase::Get(this);
+	if (!SkillDB || !SkillDB->IsReady())
+	{
+		// Skill data still loading - build the slots once it is ready
+		if (UActionRPGDataSubsystem* DataSubsystem = UActionRPGDataSubsystem::Get(this))
+		{
+			DataSubsystem->OnDataReady.AddUniqueDynamic(this, &USkillComponent::HandleDataReady);
+		}
+		return;
+	}
+
+	Loadout.SetNumSlots(NumSkillSlots);
+	for (int32 SlotIndex = 0; SlotIndex < NumSkillSlots; SlotIndex++)
+	{
+		const FName SkillID = SlotSkillIDs.IsValidIndex(SlotIndex) ? SlotSkillIDs[SlotIndex] : NAME_None;
+		const FSkillSpec* Spec = SkillID != NAME_None ? SkillDB->FindSkillSpec(SkillID) : nullptr;
+		if (SkillID != NAME_None && !Spec)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SkillComponent::RebuildLoadout - Unknown skill %s in slot %d"), *SkillID.ToString(), SlotIndex);
+		}
+
+		Loadout.SetSkill(SlotIndex, Spec ? Spec->SkillIndex : INDEX_NONE);
+	}
+}
+
+void USkillComponent::SetSkillInSlot(int32 SlotIndex, FName SkillID)
+{
+	if (!GetOwner() || !GetOwner()->HasAuthority() || SlotIndex < 0 || SlotIndex >= NumSkillSlots)
+	{
+		return;
+	}
+
+	SlotSkillIDs.SetNum(NumSkillSlots);
+	SlotSkillIDs[SlotIndex] = SkillID;
+	RebuildLoadout();
+}
+
+const FSkillSpec* USkillComponent::GetSlotSpec(int32 SlotIndex) const
+{
+	const int32 SkillIndex = Loadout.GetSkillIndex(SlotIndex);
+	if (SkillIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	const USkillDatabase* SkillDB = USkillDatabase::Get(this);
+	return SkillDB ? SkillDB->GetSkillSpec(SkillIndex) : nullptr;
+}
+
+USkillDataAsset* USkillComponent::GetSkillDataInSlot(int32 SlotIndex) const
+{
+	const FSkillSpec* Spec = GetSlotSpec(SlotIndex);
+	return Spec ? Spec->SkillData : nullptr;
+}
+
+USkillCooldownSubsystem* USkillComponent::ResolveSlotCooldowns(int32 SlotIndex, const FSkillSpec& Spec)
+{
+	USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this);
+	if (Cooldowns)
+	{
+		FSkillActivation::ResolveCooldownHandles(Spec, *Cooldowns, GetOwner(),
+			Loadout.CooldownHandles[SlotIndex], Loadout.GroupCooldownHandles[SlotIndex]);
+	}
+	return Cooldowns;
+}
+
+float USkillComponent::GetSlotCooldownRemaining(int32 SlotIndex)
+{
+	const FSkillSpec* Spec = GetSlotSpec(SlotIndex);
+	const USkillCooldownSubsystem* Cooldowns = Spec ? ResolveSlotCooldowns(SlotIndex, *Spec) : nullptr;
+	return Cooldowns
+		? FSkillActivation::GetCooldownRemaining(*Cooldowns, Loadout.CooldownHandles[SlotIndex], Loadout.GroupCooldownHandles[SlotIndex])
+		: 0.0f;
+}
+
+bool USkillComponent::ActivateSkillSlot(int32 SlotIndex, AActor* Target)
+{
+	const FSkillSpec* Spec = GetSlotSpec(SlotIndex);
+	AActor* Owner = GetOwner();
+	if (!Spec || !Owner)
+	{
+		UE_LOG(LogTemp, Log, TEXT("SkillComponent::ActivateSkillSlot - No skill in slot %d"), SlotIndex);
+		return false;
+	}
+
+	if (Owner->HasAuthority())
+	{
+		return ValidateActivation(SlotIndex, *Spec, Target, false) && ActivateAuthoritative(SlotIndex, *Spec, Target);
+	}
+
+	// Owning client: run it now, let the server confirm or reject
+	if (GetSlotCooldownRemaining(SlotIndex) > 0.0f
+		|| !FSkillActivation::CanAffordCosts(*Spec, UAttributeComponent::FindAttributeComponent(Owner)))
+	{
+		return false;
+	}
+
+	FPredictedSkillActivation Prediction;
+	Prediction.PredictionKey = NextPredictionKey;
+	Prediction.SlotIndex = static_cast<uint8>(SlotIndex);
+	if (const USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this))
+	{
+		Prediction.PreviousCooldownExpiry = Cooldowns->GetCooldownExpiry(Loadout.CooldownHandles[SlotIndex]);
+		Prediction.PreviousGroupCooldownExpiry = Cooldowns->GetCooldownExpiry(Loadout.GroupCooldownHandles[SlotIndex]);
+	}
+
+	if (!ActivateSlot(SlotIndex, *Spec, Target))
+	{
+		return false;
+	}
+
+	// Key 0 is reserved for "not predicted"
+	NextPredictionKey = NextPredictionKey == MAX_uint16 ? 1 : NextPredictionKey + 1;
+
+	PendingPredictions.Add(Prediction);
+	ServerActivateSkill(Prediction.SlotIndex, Target, Prediction.PredictionKey);
+	return true;
+}
+
+bool USkillComponent::ValidateActivation(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target, bool bRemoteRequest)
+{
+	const AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return false;
+	}
+
+	if (!FSkillActivation::CanAffordCosts(Spec, UAttributeComponent::FindAttributeComponent(Owner)))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SkillComponent::ValidateActivation - %s: cannot afford costs"), *Spec.SkillID.ToString());
+		return false;
+	}
+
+	const float CooldownRemaining = GetSlotCooldownRemaining(SlotIndex);
+	if (CooldownRemaining > (bRemoteRequest ? CooldownTolerance : 0.0f))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SkillComponent::ValidateActivation - %s: on cooldown (%.2f)"), *Spec.SkillID.ToString(), CooldownRemaining);
+		return false;
+	}
+
+	if (!FSkillActivation::IsInRange(Spec, *Owner, Target, bRemoteRequest ? RangeTolerance : 0.0f))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SkillComponent::ValidateActivation - %s: target out of range"), *Spec.SkillID.ToString());
+		return false;
+	}
+
+	return true;
+}
+
+bool USkillComponent::ActivateSlot(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target)
+{
+	AActor* Owner = GetOwner();
+	if (USkillCastSubsystem* CastSubsystem = USkillCastSubsystem::Get(this))
+	{
+		return CastSubsystem->BeginSkillCast(Owner, Spec.SkillIndex, Target);
+	}
+
+	// No cast pipeline - activate instantly
+	if (!FSkillActivation::CommitCosts(Spec, UAttributeComponent::FindAttributeComponent(Owner)))
+	{
+		return false;
+	}
+
+	if (USkillCooldownSubsystem* Cooldowns = ResolveSlotCooldowns(SlotIndex, Spec))
+	{
+		double PreviousExpiry = 0.0;
+		double PreviousGroupExpiry = 0.0;
+		FSkillActivation::CommitCooldown(Spec, *Cooldowns, Loadout.CooldownHandles[SlotIndex], Loadout.GroupCooldownHandles[SlotIndex],
+			PreviousExpiry, PreviousGroupExpiry);
+	}
+
+	FSkillActivation::Execute(Spec, *Owner, Target);
+	return true;
+}
+
+bool USkillComponent::ActivateAuthoritative(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target)
+{
+	if (!ActivateSlot(SlotIndex, Spec, Target))
+	{
+		return false;
+	}
+
+	MulticastSkillCosmetic(static_cast<uint8>(SlotIndex), Target);
+	return true;
+}
+
+bool USkillComponent::ActivateRemoteRequest(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target)
+{
+	// The client's clock runs ahead, so ValidateActivation accepted up to CooldownTolerance of cooldown.
+	// The cast pipeline refuses skills still on cooldown, so that remainder is cleared for this
+	// activation only and put back if the activation fails anyway.
+	USkillCooldownSubsystem* Cooldowns = GetSlotCooldownRemaining(SlotIndex) > 0.0f ? USkillCooldownSubsystem::Get(this) : nullptr;
+	double PreviousExpiry = 0.0;
+	double PreviousGroupExpiry = 0.0;
+	if (Cooldowns)
+	{
+		PreviousExpiry = Cooldowns->GetCooldownExpiry(Loadout.CooldownHandles[SlotIndex]);
+		PreviousGroupExpiry = Cooldowns->GetCooldownExpiry(Loadout.GroupCooldownHandles[SlotIndex]);
+		FSkillActivation::RestoreCooldown(*Cooldowns, Loadout.CooldownHandles[SlotIndex], Loadout.GroupCooldownHandles[SlotIndex], 0.0, 0.0);
+	}
+
+	if (ActivateAuthoritative(SlotIndex, Spec, Target))
+	{
+		return true;
+	}
+
+	if (Cooldowns)
+	{
+		FSkillActivation::RestoreCooldown(*Cooldowns, Loadout.CooldownHandles[SlotIndex], Loadout.GroupCooldownHandles[SlotIndex],
+			PreviousExpiry, PreviousGroupExpiry);
+	}
+	return false;
+}
+
+void USkillComponent::ServerActivateSkill_Implementation(uint8 SlotIndex, AActor* Target, uint16 PredictionKey)
+{
+	const FSkillSpec* Spec = GetSlotSpec(SlotIndex);
+	const bool bAccepted = Spec && ValidateActivation(SlotIndex, *Spec, Target, true) && ActivateRemoteRequest(SlotIndex, *Spec, Target);
+
+	if (PredictionKey == 0)
+	{
+		return;
+	}
+
+	// Resources after this request, so the client can correct its prediction
+	const UAttributeComponent* Attributes = UAttributeComponent::FindAttributeComponent(GetOwner());
+	const float ServerMana = Attributes ? Attributes->GetValue(EActionRPGAttribute::Mana) : 0.0f;
+	const float ServerStamina = Attributes ? Attributes->GetValue(EActionRPGAttribute::Stamina) : 0.0f;
+
+	if (bAccepted)
+	{
+		ClientConfirmActivation(PredictionKey, ServerMana, ServerStamina);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Log, TEXT("SkillComponent::ServerActivateSkill - Rejected slot %d (key %d)"), SlotIndex, PredictionKey);
+		ClientRejectActivation(PredictionKey, ServerMana, ServerStamina);
+	}
+}
+
+void USkillComponent::ClientConfirmActivation_Implementation(uint16 PredictionKey, float ServerMana, float ServerStamina)
+{
+	PendingPredictions.RemoveAll([PredictionKey](const FPredictedSkillActivation& Prediction)
+	{
+		return Prediction.PredictionKey == PredictionKey;
+	});
+
+	ReconcileResources(ServerMana, ServerStamina);
+}
+
+void USkillComponent::ClientRejectActivation_Implementation(uint16 PredictionKey, float ServerMana, float ServerStamina)
+{
+	const int32 PredictionIndex = PendingPredictions.IndexOfByPredicate([PredictionKey](const FPredictedSkillActivation& Prediction)
+	{
+		return Prediction.PredictionKey == PredictionKey;
+	});
+
+	if (PredictionIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FPredictedSkillActivation Prediction = PendingPredictions[PredictionIndex];
+	PendingPredictions.RemoveAt(PredictionIndex);
+	RollbackPrediction(Prediction);
+	ReconcileResources(ServerMana, ServerStamina);
+}
+
+void USkillComponent::ReconcileResources(float ServerMana, float ServerStamina)
+{
+	AActor* Caster = GetOwner();
+	UAttributeComponent* Attributes = UAttributeComponent::FindAttributeComponent(Caster);
+	if (!Attributes)
+	{
+		return;
+	}
+
+	// Predictions sent after the one answered were spent here but not yet on the server
+	const USkillCastSubsystem* CastSubsystem = USkillCastSubsystem::Get(this);
+	float PendingMana = 0.0f;
+	float PendingStamina = 0.0f;
+	for (const FPredictedSkillActivation& Prediction : PendingPredictions)
+	{
+		const FSkillSpec* Spec = GetSlotSpec(Prediction.SlotIndex);
+		if (!Spec || (CastSubsystem && CastSubsystem->GetQueuedSkillIndex(Caster) == Spec->SkillIndex))
+		{
+			// Queued behind another cast - nothing spent yet
+			continue;
+		}
+
+		PendingMana += Spec->ManaCost;
+		PendingStamina += Spec->StaminaCost;
+	}
+
+	Attributes->ApplyServerValue(EActionRPGAttribute::Mana, ServerMana - PendingMana);
+	Attributes->ApplyServerValue(EActionRPGAttribute::Stamina, ServerStamina - PendingStamina);
+}
+
+void USkillComponent::RollbackPrediction(const FPredictedSkillActivation& Prediction)
+{
+	const FSkillSpec* Spec = GetSlotSpec(Prediction.SlotIndex);
+	AActor* Caster = GetOwner();
+	if (!Spec || !Caster)
+	{
+		return;
+	}
+
+	USkillCastSubsystem* CastSubsystem = USkillCastSubsystem::Get(this);
+	if (CastSubsystem && CastSubsystem->GetQueuedSkillIndex(Caster) == Spec->SkillIndex)
+	{
+		// Still waiting behind another cast - nothing was committed yet
+		CastSubsystem->ClearQueuedSkill(Caster);
+	}
+	else
+	{
+		if (CastSubsystem && CastSubsystem->GetCastingSkillIndex(Caster) == Spec->SkillIndex)
+		{
+			CastSubsystem->InterruptCast(Caster);
+		}
+
+		if (USkillCooldownSubsystem* Cooldowns = ResolveSlotCooldowns(Prediction.SlotIndex, *Spec))
+		{
+			FSkillActivation::RestoreCooldown(*Cooldowns, Loadout.CooldownHandles[Prediction.SlotIndex], Loadout.GroupCooldownHandles[Prediction.SlotIndex],
+				Prediction.PreviousCooldownExpiry, Prediction.PreviousGroupCooldownExpiry);
+		}
+		FSkillActivation::RefundCosts(*Spec, UAttributeComponent::FindAttributeComponent(Caster));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("SkillComponent::RollbackPrediction - Server rejected %s, prediction rolled back"), *Spec->SkillID.ToString());
+	OnSkillActivationRejected.Broadcast(Spec->SkillData);
+}
+
+void USkillComponent::MulticastSkillCosmetic_Implementation(uint8 SlotIndex, AActor* Target)
+{
+	// Server and the predicting owner already ran the activation
+	if (GetOwnerRole() != ROLE_SimulatedProxy)
+	{
+		return;
+	}
+
+	OnSkillCosmetic.Broadcast(GetSkillDataInSlot(SlotIndex), Target);
+}
@@ -5,7 +5,13 @@
 #include "EnhancedInputSubsystems.h"
 #include "Characters/ActionRPGPlayerCharacter.h"
 #include "Components/Inventory/InventoryComponent.h"
+#include "Components/Skills/SkillComponent.h"
+#include "Components/Combat/ComboComponent.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
+#include "Items/Core/ItemBase.h"
 #include "Items/Pickups/ItemPickupActor.h"
+#include "Items/Pickups/WorldItemSubsystem.h"
+#include "Items/Pickups/InteractionSubsystem.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
@@ -86,11 +92,6 @@ void AActionRPGPlayerController::SetupInputComponent()
 			EnhancedInputComponent->BindAction(InteractAction, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnInteract);
 		}
 
-		if (AttackAction)
-		{
-			EnhancedInputComponent->BindAction(AttackAction, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnAttack);
-		}
-
 		if (DodgeAction)
 		{
 			EnhancedInputComponent->BindAction(DodgeAction, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnDodge);
@@ -101,56 +102,22 @@ void AActionRPGPlayerController::SetupInputComponent()
 			EnhancedInputComponent->BindAction(OpenInventoryAction, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnOpenInventory);
 		}
 
-		// Bind skill slot actions
-		if (SkillSlot1Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot1Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot1);
-		}
-
-		if (SkillSlot2Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot2Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot2);
-		}
-
-		if (SkillSlot3Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot3Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot3);
-		}
-
-		if (SkillSlot4Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot4Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot4);
-		}
-
-		if (SkillSlot5Action)
+		// Bind skill and quick-use slot inputs (once per press - held keys don't re-fire)
+		if (SlotInputBindings.Num() == 0)
 		{
-			EnhancedInputComponent->BindAction(SkillSlot5Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot5);
+			BuildLegacySlotInputBindings();
 		}
 
-		if (SkillSlot6Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot6Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot6);
-		}
-
-		if (SkillSlot7Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot7Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot7);
-		}
-
-		if (SkillSlot8Action)
-		{
-			EnhancedInputComponent->BindAction(SkillSlot8Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSkillSlot8);
-		}
-
-		// Quick-Use Bar bindings (for consumables - Phase 2)
-		if (QuickUseSlot9Action)
-		{
-			EnhancedInputComponent->BindAction(QuickUseSlot9Action, ETriggerEvent::Triggered, this, &AActionRPGPlayerController::OnQuickUseSlot9);
-		}
+		AddAttackSlotInputBinding();
 
-		if (QuickUseSlot10Action)
+		TSet<const UInputAction*> BoundSlotActions;
+		for (const FSlotInputBinding& Binding : SlotInputBindings)
 		{
-			EnhancedInputComponent->BindAction(QuickUseSlot10Action, ETriggerEvent::Triggered, this, &AActionRPGPlayerController::OnQuickUseSlot10);
+			if (Binding.Action && !BoundSlotActions.Contains(Binding.Action))
+			{
+				BoundSlotActions.Add(Binding.Action);
+				EnhancedInputComponent->BindAction(Binding.Action, ETriggerEvent::Started, this, &AActionRPGPlayerController::OnSlotInputStarted);
+			}
 		}
 	}
 	else
@@ -199,160 +166,61 @@ void AActionRPGPlayerController::OnInteract()
 		return;
 	}
 
-	// Get world context
-	UWorld* World = GetWorld();
-	if (!World)
+	// Best target under the cursor (or nearest in range) is kept up to date by the interaction subsystem
+	UInteractionSubsystem* Interaction = UInteractionSubsystem::Get(this);
+	bool bMaterialized = false;
+	AItemPickupActor* ClosestPickup = Interaction ? Interaction->ResolveInteractTarget(this, bMaterialized) : nullptr;
+	if (!ClosestPickup)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnInteract: World is null"));
+		UE_LOG(LogTemp, Verbose, TEXT("OnInteract: No item pickup found under cursor"));
 		return;
 	}
 
-	// Get mouse cursor position and direction for line trace (cursor-based pickup)
-	FVector TraceStart;
-	FVector TraceDirection;
-	FVector MouseWorldLocation;
-	FVector MouseWorldDirection;
-	
-	if (DeprojectMousePositionToWorld(MouseWorldLocation, MouseWorldDirection))
+	UE_LOG(LogTemp, Log, TEXT("OnInteract: Found item pickup under cursor: %s (Distance: %.2f)"), 
+	       *ClosestPickup->GetName(), FVector::Dist(PlayerCharacter->GetActorLocation(), ClosestPickup->GetActorLocation()));
+
+	if (!HasAuthority())
 	{
-		// Use camera position as trace start for top-down gameplay
-		if (PlayerCharacter->CameraComponent)
-		{
-			TraceStart = PlayerCharacter->CameraComponent->GetComponentLocation();
-		}
-		else
-		{
-			// Fallback: use player location elevated for top-down view
-			TraceStart = PlayerCharacter->GetActorLocation();
-			TraceStart.Z += 500.0f;
-		}
-		TraceDirection = MouseWorldDirection;
+		ServerInteractWithPickup(ClosestPickup);
+		return;
 	}
-	else
+
+	InteractWithPickup(*PlayerCharacter, *ClosestPickup, bMaterialized);
+}
+
+void AActionRPGPlayerController::ServerInteractWithPickup_Implementation(AItemPickupActor* Pickup)
+{
+	// The client picked the target; the server checks it is still there and in reach
+	AActionRPGPlayerCharacter* PlayerCharacter = Cast<AActionRPGPlayerCharacter>(GetPawn());
+	if (!PlayerCharacter || !IsValid(Pickup) || Pickup->IsInPickupPool() || !Pickup->IsPlayerInRange(PlayerCharacter))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OnInteract: Failed to deproject mouse position to world"));
+		UE_LOG(LogTemp, Verbose, TEXT("ServerInteractWithPickup: Pickup gone or out of range"));
 		return;
 	}
 
-	// Calculate trace end (trace from camera through mouse cursor direction)
-	// For top-down view, trace a reasonable distance (1000 units should be enough)
-	FVector TraceEnd = TraceStart + (TraceDirection * 1000.0f);
+	InteractWithPickup(*PlayerCharacter, *Pickup, false);
+}
 
-	// Use sphere sweep to create a cone-like detection area
-	// This makes it easier to pick up small items
-	// Cone parameters: start small at camera, expand as it goes down
-	float ConeStartRadius = 10.0f;  // Small radius at start (camera)
-	float ConeEndRadius = 100.0f;    // Larger radius at end (ground level)
-	
-	// Calculate distance for radius interpolation
-	float TraceDistance = (TraceEnd - TraceStart).Size();
-	
-	// Use the larger radius for the sweep (sweep uses a single radius, so we use the max)
-	// The expanding effect comes from doing multiple sweeps or using the end radius
-	float SweepRadius = ConeEndRadius;
-	
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(PlayerCharacter); // Ignore player character
-	QueryParams.bTraceComplex = false; // Use simple collision for performance
-	
-	// Perform sphere sweep to find items in cone area
-	TArray<FHitResult> HitResults;
-	FCollisionShape SweepShape = FCollisionShape::MakeSphere(SweepRadius);
-	
-	// Sweep against world dynamic objects (item pickups use ECC_WorldDynamic)
-	bool bHit = World->SweepMultiByChannel(
-		HitResults,
-		TraceStart,
-		TraceEnd,
-		FQuat::Identity,
-		ECC_WorldDynamic,
-		SweepShape,
-		QueryParams
-	);
-	
-	// Find the closest ItemPickupActor in the sweep results
-	AItemPickupActor* ClosestPickup = nullptr;
-	float ClosestDistance = MAX_FLT;
-	FVector PlayerLocation = PlayerCharacter->GetActorLocation();
-	
-	if (bHit && HitResults.Num() > 0)
+void AActionRPGPlayerController::InteractWithPickup(AActionRPGPlayerCharacter& PlayerCharacter, AItemPickupActor& Pickup, bool bMaterialized)
+{
+	if (Pickup.CanPickup(&PlayerCharacter))
 	{
-		for (const FHitResult& Hit : HitResults)
-		{
-			if (AItemPickupActor* Pickup = Cast<AItemPickupActor>(Hit.GetActor()))
-			{
-				// Find the closest pickup to the player (or to the trace center)
-				float Distance = FVector::Dist(PlayerLocation, Pickup->GetActorLocation());
-				if (Distance < ClosestDistance)
-				{
-					ClosestDistance = Distance;
-					ClosestPickup = Pickup;
-				}
-			}
-		}
+		UE_LOG(LogTemp, Log, TEXT("OnInteract: Attempting to pickup item: %s"), *Pickup.GetName());
+		Pickup.PickupItem(&PlayerCharacter);
 	}
-	
-	// If no dynamic objects found, try world static
-	if (!ClosestPickup)
+	else
 	{
-		HitResults.Empty();
-		bHit = World->SweepMultiByChannel(
-			HitResults,
-			TraceStart,
-			TraceEnd,
-			FQuat::Identity,
-			ECC_WorldStatic,
-			SweepShape,
-			QueryParams
-		);
-		
-		if (bHit && HitResults.Num() > 0)
-		{
-			for (const FHitResult& Hit : HitResults)
-			{
-				if (AItemPickupActor* Pickup = Cast<AItemPickupActor>(Hit.GetActor()))
-				{
-					float Distance = FVector::Dist(PlayerLocation, Pickup->GetActorLocation());
-					if (Distance < ClosestDistance)
-					{
-						ClosestDistance = Distance;
-						ClosestPickup = Pickup;
-					}
-				}
-			}
-		}
+		UE_LOG(LogTemp, Warning, TEXT("OnInteract: Cannot pickup item - validation failed"));
 	}
-	
-	// Try to pickup the closest item found
-	if (ClosestPickup)
+
+	// A stored item made into an actor for this press goes back into storage if it is still on the ground
+	if (bMaterialized && IsValid(&Pickup) && !Pickup.IsInPickupPool())
 	{
-		UE_LOG(LogTemp, Log, TEXT("OnInteract: Found item pickup in cone area: %s (Distance: %.2f)"), 
-		       *ClosestPickup->GetName(), ClosestDistance);
-		
-		if (ClosestPickup->CanPickup(PlayerCharacter))
+		if (UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this))
 		{
-			UE_LOG(LogTemp, Log, TEXT("OnInteract: Attempting to pickup item: %s"), 
-			       *ClosestPickup->GetName());
-			
-			ClosestPickup->PickupItem(PlayerCharacter);
-			UE_LOG(LogTemp, Log, TEXT("OnInteract: Successfully picked up item: %s"), 
-			       *ClosestPickup->GetName());
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("OnInteract: Cannot pickup item - validation failed"));
+			WorldItems->DematerializePickup(&Pickup);
 		}
 	}
-	else
-	{
-		UE_LOG(LogTemp, Verbose, TEXT("OnInteract: No item pickup found in cone area"));
-	}
-}
-
-void AActionRPGPlayerController::OnAttack()
-{
-	// TODO: Implement attack in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Attack pressed"));
 }
 
 void AActionRPGPlayerController::OnDodge()
@@ -459,116 +327,254 @@ void AActionRPGPlayerController::OnOpenInventory()
 	}
 }
 
-void AActionRPGPlayerController::OnSkillSlot1()
+void AActionRPGPlayerController::PlayerTick(float DeltaTime)
 {
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 1 pressed"));
-}
+	Super::PlayerTick(DeltaTime);
 
-void AActionRPGPlayerController::OnSkillSlot2()
-{
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 2 pressed"));
+	if (InputBuffer.Num() > 0)
+	{
+		FlushInputBuffer();
+	}
 }
 
-void AActionRPGPlayerController::OnSkillSlot3()
+void AActionRPGPlayerController::BuildLegacySlotInputBindings()
 {
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 3 pressed"));
-}
+	const TObjectPtr<UInputAction> SkillSlotActions[] =
+	{
+		SkillSlot1Action, SkillSlot2Action, SkillSlot3Action, SkillSlot4Action,
+		SkillSlot5Action, SkillSlot6Action, SkillSlot7Action, SkillSlot8Action
+	};
 
-void AActionRPGPlayerController::OnSkillSlot4()
-{
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 4 pressed"));
-}
+	for (int32 SlotIndex = 0; SlotIndex < UE_ARRAY_COUNT(SkillSlotActions); ++SlotIndex)
+	{
+		if (SkillSlotActions[SlotIndex])
+		{
+			SlotInputBindings.Emplace(SkillSlotActions[SlotIndex], ESlotInputType::SkillSlot, SlotIndex);
+		}
+	}
 
-void AActionRPGPlayerController::OnSkillSlot5()
-{
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 5 pressed"));
-}
+	// Quick-use slots 9 and 10 (indexes 8 and 9)
+	if (QuickUseSlot9Action)
+	{
+		SlotInputBindings.Emplace(QuickUseSlot9Action, ESlotInputType::QuickUseSlot, 8);
+	}
 
-void AActionRPGPlayerController::OnSkillSlot6()
-{
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 6 pressed"));
+	if (QuickUseSlot10Action)
+	{
+		SlotInputBindings.Emplace(QuickUseSlot10Action, ESlotInputType::QuickUseSlot, 9);
+	}
 }
 
-void AActionRPGPlayerController::OnSkillSlot7()
+void AActionRPGPlayerController::AddAttackSlotInputBinding()
 {
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 7 pressed"));
-}
+	if (!AttackAction)
+	{
+		return;
+	}
 
-void AActionRPGPlayerController::OnSkillSlot8()
-{
-	// TODO: Implement skill activation in Phase 2
-	UE_LOG(LogTemp, Warning, TEXT("Skill Slot 8 pressed"));
+	for (const FSlotInputBinding& Binding : SlotInputBindings)
+	{
+		if (Binding.Action == AttackAction)
+		{
+			return;
+		}
+	}
+
+	SlotInputBindings.Emplace(AttackAction, ESlotInputType::Attack, 0);
 }
 
-void AActionRPGPlayerController::OnQuickUseSlot9(const FInputActionValue& Value)
+void AActionRPGPlayerController::OnSlotInputStarted(const FInputActionInstance& Instance)
 {
-	if (Value.Get<bool>())
+	const UInputAction* Action = Instance.GetSourceAction();
+	for (int32 BindingIndex = 0; BindingIndex < SlotInputBindings.Num(); ++BindingIndex)
 	{
-		AActionRPGPlayerCharacter* PlayerCharacter = Cast<AActionRPGPlayerCharacter>(GetPawn());
-		if (!PlayerCharacter)
+		const FSlotInputBinding& Binding = SlotInputBindings[BindingIndex];
+		if (Binding.Action != Action)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("OnQuickUseSlot9: Pawn is not AActionRPGPlayerCharacter or is NULL"));
-			return;
+			continue;
 		}
 
-		UInventoryComponent* InventoryComp = PlayerCharacter->InventoryComponent;
-		if (InventoryComp)
+		// A new press supersedes whatever of its type was still buffered
+		InputBuffer.RemoveAll([this, &Binding](const FBufferedSlotInput& Buffered)
 		{
-			bool bSuccess = InventoryComp->UseQuickUseSlot(8); // Slot 9 (index 8)
-			if (bSuccess)
-			{
-				UE_LOG(LogTemp, Log, TEXT("OnQuickUseSlot9 - Used quick-use slot 9 successfully"));
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("OnQuickUseSlot9 - Failed to use quick-use slot 9 (slot may be empty)"));
-			}
-		}
-		else
+			return SlotInputBindings[Buffered.BindingIndex].Type == Binding.Type;
+		});
+
+		if (ExecuteSlotBinding(Binding) == ESlotInputResult::Retry && Binding.bBufferable)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("OnQuickUseSlot9: InventoryComponent not found"));
+			BufferSlotInput(BindingIndex);
 		}
 	}
 }
 
-void AActionRPGPlayerController::OnQuickUseSlot10(const FInputActionValue& Value)
+void AActionRPGPlayerController::BufferSlotInput(int32 BindingIndex)
 {
-	if (Value.Get<bool>())
+	const UWorld* World = GetWorld();
+	if (!World || InputBufferWindow <= 0.0f)
 	{
-		AActionRPGPlayerCharacter* PlayerCharacter = Cast<AActionRPGPlayerCharacter>(GetPawn());
-		if (!PlayerCharacter)
+		return;
+	}
+
+	// Repeats of a buffered press only refresh its timestamp
+	for (FBufferedSlotInput& Buffered : InputBuffer)
+	{
+		if (Buffered.BindingIndex == BindingIndex)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("OnQuickUseSlot10: Pawn is not AActionRPGPlayerCharacter or is NULL"));
+			Buffered.Timestamp = World->GetTimeSeconds();
 			return;
 		}
+	}
 
-		UInventoryComponent* InventoryComp = PlayerCharacter->InventoryComponent;
-		if (InventoryComp)
+	FBufferedSlotInput& Buffered = InputBuffer.AddDefaulted_GetRef();
+	Buffered.BindingIndex = BindingIndex;
+	Buffered.Timestamp = World->GetTimeSeconds();
+}
+
+void AActionRPGPlayerController::FlushInputBuffer()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		InputBuffer.Reset();
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	for (int32 Index = InputBuffer.Num() - 1; Index >= 0; --Index)
+	{
+		const FBufferedSlotInput Buffered = InputBuffer[Index];
+		if (!SlotInputBindings.IsValidIndex(Buffered.BindingIndex) || Now - Buffered.Timestamp > InputBufferWindow)
 		{
-			bool bSuccess = InventoryComp->UseQuickUseSlot(9); // Slot 10 (index 9)
-			if (bSuccess)
-			{
-				UE_LOG(LogTemp, Log, TEXT("OnQuickUseSlot10 - Used quick-use slot 10 successfully"));
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("OnQuickUseSlot10 - Failed to use quick-use slot 10 (slot may be empty)"));
-			}
+			InputBuffer.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
 		}
-		else
+
+		// Keep only presses still waiting on something that will pass
+		if (ExecuteSlotBinding(SlotInputBindings[Buffered.BindingIndex]) != ESlotInputResult::Retry)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("OnQuickUseSlot10: InventoryComponent not found"));
+			InputBuffer.RemoveAtSwap(Index, 1, EAllowShrinking::No);
 		}
 	}
 }
 
+ESlotInputResult AActionRPGPlayerController::ExecuteSlotBinding(const FSlotInputBinding& Binding)
+{
+	switch (Binding.Type)
+	{
+	case ESlotInputType::SkillSlot:
+		return ActivateSkillSlot(Binding.SlotIndex);
+	case ESlotInputType::QuickUseSlot:
+		return UseQuickUseSlot(Binding.SlotIndex);
+	case ESlotInputType::Attack:
+		return PerformAttack();
+	}
+
+	return ESlotInputResult::Failed;
+}
+
+ESlotInputResult AActionRPGPlayerController::ActivateSkillSlot(int32 SlotIndex)
+{
+	AActionRPGCharacter* ControlledCharacter = Cast<AActionRPGCharacter>(GetPawn());
+	if (!ControlledCharacter || !ControlledCharacter->SkillComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ActivateSkillSlot: Pawn has no SkillComponent (slot %d)"), SlotIndex + 1);
+		return ESlotInputResult::Failed;
+	}
+
+	if (!ControlledCharacter->SkillComponent->GetSkillDataInSlot(SlotIndex))
+	{
+		return ESlotInputResult::Failed;
+	}
+
+	// Still cooling down - leave it to the buffer without running the activation checks
+	if (ControlledCharacter->SkillComponent->GetSlotCooldownRemaining(SlotIndex) > 0.0f)
+	{
+		return ESlotInputResult::Retry;
+	}
+
+	// Target the character under the cursor, if any
+	AActor* Target = nullptr;
+	FHitResult HitResult;
+	if (GetHitResultUnderCursor(ECC_Pawn, false, HitResult))
+	{
+		Target = Cast<AActionRPGCharacter>(HitResult.GetActor());
+	}
+
+	if (Target == ControlledCharacter)
+	{
+		Target = nullptr;
+	}
+
+	// A busy caster queues the skill, so what is left (costs, range) won't clear up within the buffer window
+	if (!ControlledCharacter->SkillComponent->ActivateSkillSlot(SlotIndex, Target))
+	{
+		return ESlotInputResult::Failed;
+	}
+
+	// Let the combo graph branch into a follow-up
+	if (ControlledCharacter->ComboComponent && SlotIndex >= 0 && SlotIndex < USkillComponent::NumSkillSlots)
+	{
+		ControlledCharacter->ComboComponent->HandleComboInput(static_cast<EComboInput>(static_cast<int32>(EComboInput::SkillSlot1) + SlotIndex));
+	}
+
+	return ESlotInputResult::Executed;
+}
+
+ESlotInputResult AActionRPGPlayerController::PerformAttack()
+{
+	AActionRPGCharacter* ControlledCharacter = Cast<AActionRPGCharacter>(GetPawn());
+	if (!ControlledCharacter || !ControlledCharacter->ComboComponent)
+	{
+		return ESlotInputResult::Failed;
+	}
+
+	// Only a press waiting for its combo window is worth keeping
+	switch (ControlledCharacter->ComboComponent->HandleComboInput(EComboInput::Attack))
+	{
+	case EComboStep::Advanced:
+		return ESlotInputResult::Executed;
+	case EComboStep::WindowNotOpen:
+		return ESlotInputResult::Retry;
+	case EComboStep::NoTransition:
+		break;
+	}
+
+	return ESlotInputResult::Failed;
+}
+
+ESlotInputResult AActionRPGPlayerController::UseQuickUseSlot(int32 SlotIndex)
+{
+	AActionRPGPlayerCharacter* PlayerCharacter = Cast<AActionRPGPlayerCharacter>(GetPawn());
+	if (!PlayerCharacter)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UseQuickUseSlot: Pawn is not AActionRPGPlayerCharacter or is NULL"));
+		return ESlotInputResult::Failed;
+	}
+
+	UInventoryComponent* InventoryComp = PlayerCharacter->InventoryComponent;
+	if (!InventoryComp)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("UseQuickUseSlot: InventoryComponent not found"));
+		return ESlotInputResult::Failed;
+	}
+
+	// Item still on its (shared) cooldown - leave it to the buffer without running the use checks
+	const FQuickUseSlot QuickSlot = InventoryComp->GetQuickUseSlot(SlotIndex);
+	const USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this);
+	if (Cooldowns && QuickSlot.Item && Cooldowns->GetItemCooldownRemaining(PlayerCharacter, QuickSlot.Item->ItemData) > 0.0f)
+	{
+		return ESlotInputResult::Retry;
+	}
+
+	const bool bSuccess = InventoryComp->UseQuickUseSlot(SlotIndex);
+	if (bSuccess)
+	{
+		UE_LOG(LogTemp, Log, TEXT("UseQuickUseSlot - Used quick-use slot %d successfully"), SlotIndex + 1);
+	}
+
+	return bSuccess ? ESlotInputResult::Executed : ESlotInputResult::Failed;
+}
+
 UInputAction* AActionRPGPlayerController::GetInputActionForQuickUseSlot(int32 SlotIndex) const
 {
 	// Validate slot index
@@ -577,32 +583,13 @@ UInputAction* AActionRPGPlayerController::GetInputActionForQuickUseSlot(int32 Sl
 		return nullptr;
 	}
 
-	// Return the InputAction for this slot
-	if (SlotIndex < 8)
-	{
-		// Slots 0-7 (displayed as 1-8) - Skill slots
-		switch (SlotIndex)
-		{
-		case 0: return SkillSlot1Action;
-		case 1: return SkillSlot2Action;
-		case 2: return SkillSlot3Action;
-		case 3: return SkillSlot4Action;
-		case 4: return SkillSlot5Action;
-		case 5: return SkillSlot6Action;
-		case 6: return SkillSlot7Action;
-		case 7: return SkillSlot8Action;
-		}
-	}
-	else
+	// Slots 0-7 (displayed as 1-8) are skill slots, 8-9 (displayed as 9-0) quick-use slots
+	const ESlotInputType Type = SlotIndex < 8 ? ESlotInputType::SkillSlot : ESlotInputType::QuickUseSlot;
+	for (const FSlotInputBinding& Binding : SlotInputBindings)
 	{
-		// Slots 8-9 (displayed as 9-0) - Quick-use slots
-		if (SlotIndex == 8)
-		{
-			return QuickUseSlot9Action;
-		}
-		else if (SlotIndex == 9)
+		if (Binding.Type == Type && Binding.SlotIndex == SlotIndex)
 		{
-			return QuickUseSlot10Action;
+			return Binding.Action;
 		}
 	}
 
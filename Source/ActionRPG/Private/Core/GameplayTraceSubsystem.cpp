@@ -0,0 +1,218 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/GameplayTraceSubsystem.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Trace Results"), STAT_TraceResults, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Traces"), STAT_AsyncTraces, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sync Traces"), STAT_SyncTraces, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Traces"), STAT_QueuedTraces, STATGROUP_ActionRPG);
+
+UGameplayTraceSubsystem* UGameplayTraceSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UGameplayTraceSubsystem>() : nullptr;
+}
+
+bool UGameplayTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGameplayTraceSubsystem::Deinitialize()
+{
+	// Pending callbacks are dropped - their owners are going away with the world
+	QueuedTraces.Empty();
+	InFlightTraces.Empty();
+	DeliveringTraces.Empty();
+	AsyncTracesThisFrame = 0;
+	SyncTracesThisFrame = 0;
+	AsyncTracesLastFrame = 0;
+	SyncTracesLastFrame = 0;
+	SET_DWORD_STAT(STAT_QueuedTraces, 0);
+
+	Super::Deinitialize();
+}
+
+void UGameplayTraceSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	UpdateFrameCounters();
+	DeliverResults(*World);
+
+	// Spend what is left of this frame's budget on the backlog
+	int32 NumSubmitted = 0;
+	while (NumSubmitted < QueuedTraces.Num() && AsyncTracesThisFrame < MaxAsyncTracesPerFrame)
+	{
+		SubmitTrace(*World, MoveTemp(QueuedTraces[NumSubmitted]));
+		NumSubmitted++;
+	}
+	QueuedTraces.RemoveAt(0, NumSubmitted, EAllowShrinking::No);
+
+	SET_DWORD_STAT(STAT_QueuedTraces, QueuedTraces.Num());
+}
+
+TStatId UGameplayTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGameplayTraceSubsystem, STATGROUP_Tickables);
+}
+
+void UGameplayTraceSubsystem::RequestLineTrace(const FVector& Start, const FVector& End, ECollisionChannel Channel,
+	const FCollisionQueryParams& Params, FGameplayTraceCallback&& Callback)
+{
+	FQueuedTrace Request;
+	Request.Start = Start;
+	Request.End = End;
+	Request.Channel = Channel;
+	Request.Params = Params;
+	Request.Callback = MoveTemp(Callback);
+	AddRequest(MoveTemp(Request));
+}
+
+void UGameplayTraceSubsystem::RequestSweep(const FVector& Start, const FVector& End, const FCollisionShape& Shape, ECollisionChannel Channel,
+	const FCollisionQueryParams& Params, FGameplayTraceCallback&& Callback)
+{
+	FQueuedTrace Request;
+	Request.Start = Start;
+	Request.End = End;
+	Request.Shape = Shape;
+	Request.Channel = Channel;
+	Request.Params = Params;
+	Request.Callback = MoveTemp(Callback);
+	AddRequest(MoveTemp(Request));
+}
+
+bool UGameplayTraceSubsystem::LineTraceSync(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel,
+	const FCollisionQueryParams& Params)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	UpdateFrameCounters();
+	SyncTracesThisFrame++;
+	INC_DWORD_STAT(STAT_SyncTraces);
+
+	return World->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+}
+
+bool UGameplayTraceSubsystem::SweepSync(FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionShape& Shape,
+	ECollisionChannel Channel, const FCollisionQueryParams& Params)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	UpdateFrameCounters();
+	SyncTracesThisFrame++;
+	INC_DWORD_STAT(STAT_SyncTraces);
+
+	return World->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, Channel, Shape, Params);
+}
+
+void UGameplayTraceSubsystem::AddRequest(FQueuedTrace&& Request)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	UpdateFrameCounters();
+
+	// Keep request order: nothing jumps ahead of an existing backlog
+	if (QueuedTraces.Num() == 0 && AsyncTracesThisFrame < MaxAsyncTracesPerFrame)
+	{
+		SubmitTrace(*World, MoveTemp(Request));
+		return;
+	}
+
+	QueuedTraces.Add(MoveTemp(Request));
+	SET_DWORD_STAT(STAT_QueuedTraces, QueuedTraces.Num());
+}
+
+void UGameplayTraceSubsystem::SubmitTrace(UWorld& World, FQueuedTrace&& Request)
+{
+	FInFlightTrace& InFlight = InFlightTraces.AddDefaulted_GetRef();
+	InFlight.Callback = MoveTemp(Request.Callback);
+	InFlight.SubmitFrame = GFrameCounter;
+
+	if (Request.Shape.IsLine())
+	{
+		InFlight.Handle = World.AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End,
+			Request.Channel, Request.Params);
+	}
+	else
+	{
+		InFlight.Handle = World.AsyncSweepByChannel(EAsyncTraceType::Single, Request.Start, Request.End, FQuat::Identity,
+			Request.Channel, Request.Shape, Request.Params);
+	}
+
+	AsyncTracesThisFrame++;
+	INC_DWORD_STAT(STAT_AsyncTraces);
+}
+
+void UGameplayTraceSubsystem::DeliverResults(UWorld& World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TraceResults);
+
+	if (InFlightTraces.Num() == 0)
+	{
+		return;
+	}
+
+	Swap(InFlightTraces, DeliveringTraces);
+
+	FTraceDatum TraceData;
+	const FHitResult NoHit;
+	for (FInFlightTrace& Trace : DeliveringTraces)
+	{
+		if (Trace.SubmitFrame == GFrameCounter)
+		{
+			// Submitted this frame - its batch hasn't run yet
+			InFlightTraces.Add(MoveTemp(Trace));
+		}
+		else if (World.QueryTraceData(Trace.Handle, TraceData))
+		{
+			const FHitResult* Hit = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit ? &TraceData.OutHits[0] : nullptr;
+			Trace.Callback(Hit != nullptr, Hit ? *Hit : NoHit);
+		}
+		else
+		{
+			// The result buffer was recycled (e.g. a hitch skipped our tick); report a miss rather than never answering
+			Trace.Callback(false, NoHit);
+		}
+	}
+
+	DeliveringTraces.Reset();
+}
+
+void UGameplayTraceSubsystem::UpdateFrameCounters()
+{
+	if (CountedFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	AsyncTracesLastFrame = CountedFrame + 1 == GFrameCounter ? AsyncTracesThisFrame : 0;
+	SyncTracesLastFrame = CountedFrame + 1 == GFrameCounter ? SyncTracesThisFrame : 0;
+	AsyncTracesThisFrame = 0;
+	SyncTracesThisFrame = 0;
+	CountedFrame = GFrameCounter;
+}
@@ -0,0 +1,307 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/GroundHeightSubsystem.h"
+#include "Core/GameplayTraceSubsystem.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Height Cache Hits"), STAT_GroundHeightHits, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ground Height Cache Misses"), STAT_GroundHeightMisses, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Ground Height Cells"), STAT_GroundHeightCells, STATGROUP_ActionRPG);
+
+namespace GroundHeightSubsystemPrivate
+{
+	// Samples on steeper ground (about 60 degrees) are not extrapolated across their column
+	static constexpr float MinCachedNormalZ = 0.5f;
+
+	// Golden angle in radians - consecutive scatter points never line up
+	static constexpr float ScatterAngleStep = 2.39996323f;
+
+	// A WorldStatic channel trace also hits pawns, props and platforms that block the channel;
+	// only geometry that can never move is safe to cache for the whole column
+	static bool IsStaticGround(const FHitResult& Hit)
+	{
+		const UPrimitiveComponent* Component = Hit.GetComponent();
+		return Component && Component->Mobility == EComponentMobility::Static;
+	}
+}
+
+UGroundHeightSubsystem* UGroundHeightSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UGroundHeightSubsystem>() : nullptr;
+}
+
+bool UGroundHeightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGroundHeightSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UGroundHeightSubsystem::HandleLevelChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UGroundHeightSubsystem::HandleLevelChanged);
+}
+
+void UGroundHeightSubsystem::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+	LevelAddedHandle.Reset();
+	LevelRemovedHandle.Reset();
+
+	InvalidateAll();
+
+	Super::Deinitialize();
+}
+
+bool UGroundHeightSubsystem::GetGroundHeight(const FVector& Location, float ReferenceZ, float& OutGroundZ, const AActor* IgnoredActor)
+{
+	using namespace GroundHeightSubsystemPrivate;
+
+	UGameplayTraceSubsystem* Traces = UGameplayTraceSubsystem::Get(this);
+	const FIntPoint Key = GetCellKey(Location);
+	const FVector TraceStart(Location.X, Location.Y, ReferenceZ + TraceUpDistance);
+	const FVector TraceEnd(Location.X, Location.Y, ReferenceZ - TraceDownDistance);
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(GroundHeight), false, IgnoredActor);
+
+	bool bHasStaticGround = false;
+	float GroundZ = 0.0f;
+	if (FindCachedHeight(Key, Location, ReferenceZ, bHasStaticGround, GroundZ))
+	{
+		INC_DWORD_STAT(STAT_GroundHeightHits);
+	}
+	else if (Traces)
+	{
+		INC_DWORD_STAT(STAT_GroundHeightMisses);
+
+		FHitResult Hit;
+		FGroundCell Cell;
+		Cell.MissReferenceZ = ReferenceZ;
+		if (!Traces->LineTraceSync(Hit, TraceStart, TraceEnd, ECC_WorldStatic, Params))
+		{
+			StoreSample(Key, Cell);
+		}
+		else if (IsStaticGround(Hit))
+		{
+			Cell.Point = Hit.ImpactPoint;
+			Cell.Normal = Hit.ImpactNormal;
+			Cell.bHasGround = true;
+			StoreSample(Key, Cell);
+			bHasStaticGround = true;
+			GroundZ = Hit.ImpactPoint.Z;
+		}
+		else
+		{
+			// Movable blocker - good for this drop, not for the cache
+			OutGroundZ = Hit.ImpactPoint.Z;
+			return true;
+		}
+	}
+
+	if (bHasStaticGround)
+	{
+		OutGroundZ = GroundZ;
+		return true;
+	}
+
+	// No static ground - platforms and other WorldDynamic surfaces may move, so they are never cached
+	FHitResult Hit;
+	if (Traces && Traces->LineTraceSync(Hit, TraceStart, TraceEnd, ECC_WorldDynamic, Params))
+	{
+		OutGroundZ = Hit.ImpactPoint.Z;
+		return true;
+	}
+
+	return false;
+}
+
+int32 UGroundHeightSubsystem::GetScatterLocations(const FVector& Center, float Radius, int32 Count, TArray<FVector>& OutLocations, const AActor* IgnoredActor)
+{
+	using namespace GroundHeightSubsystemPrivate;
+
+	// Even area coverage: point i sits at radius sqrt(i / Count), turned by the golden angle
+	const int32 NumBefore = OutLocations.Num();
+	OutLocations.Reserve(NumBefore + Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		const float Distance = Radius * FMath::Sqrt((Index + 0.5f) / Count);
+		float Sin;
+		float Cos;
+		FMath::SinCos(&Sin, &Cos, Index * ScatterAngleStep);
+
+		FVector Location(Center.X + Cos * Distance, Center.Y + Sin * Distance, Center.Z);
+		float GroundZ = 0.0f;
+		if (GetGroundHeight(Location, Center.Z, GroundZ, IgnoredActor))
+		{
+			Location.Z = GroundZ;
+			OutLocations.Add(Location);
+		}
+	}
+
+	return OutLocations.Num() - NumBefore;
+}
+
+void UGroundHeightSubsystem::PrefetchArea(const FVector& Center, float Radius)
+{
+	UGameplayTraceSubsystem* Traces = UGameplayTraceSubsystem::Get(this);
+	if (!Traces)
+	{
+		return;
+	}
+
+	const FIntPoint MinKey = GetCellKey(Center - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxKey = GetCellKey(Center + FVector(Radius, Radius, 0.0f));
+	const float ReferenceZ = Center.Z;
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(GroundHeightPrefetch), false);
+
+	for (int32 Y = MinKey.Y; Y <= MaxKey.Y; Y++)
+	{
+		for (int32 X = MinKey.X; X <= MaxKey.X; X++)
+		{
+			const FIntPoint Key(X, Y);
+			if (Cells.Contains(Key) || PendingCells.Contains(Key))
+			{
+				continue;
+			}
+
+			// Sample the middle of the column
+			const FVector2D CellCenter((X + 0.5f) * CellSize, (Y + 0.5f) * CellSize);
+			const FVector TraceStart(CellCenter, ReferenceZ + TraceUpDistance);
+			const FVector TraceEnd(CellCenter, ReferenceZ - TraceDownDistance);
+
+			PendingCells.Add(Key);
+			Traces->RequestLineTrace(TraceStart, TraceEnd, ECC_WorldStatic, Params,
+				[WeakThis = TWeakObjectPtr<UGroundHeightSubsystem>(this), Key, ReferenceZ, Generation = CacheGeneration](bool bBlockingHit, const FHitResult& Hit)
+				{
+					using namespace GroundHeightSubsystemPrivate;
+
+					UGroundHeightSubsystem* This = WeakThis.Get();
+					if (!This || This->CacheGeneration != Generation)
+					{
+						return;
+					}
+
+					This->PendingCells.Remove(Key);
+
+					// Something movable is standing on the column; a later query samples it again
+					if (bBlockingHit && !IsStaticGround(Hit))
+					{
+						return;
+					}
+
+					FGroundCell Cell;
+					Cell.MissReferenceZ = ReferenceZ;
+					if (bBlockingHit)
+					{
+						Cell.Point = Hit.ImpactPoint;
+						Cell.Normal = Hit.ImpactNormal;
+						Cell.bHasGround = true;
+					}
+					This->StoreSample(Key, Cell);
+				});
+		}
+	}
+}
+
+void UGroundHeightSubsystem::InvalidateAll()
+{
+	Cells.Empty();
+	PendingCells.Empty();
+	CacheGeneration++;
+	SET_DWORD_STAT(STAT_GroundHeightCells, 0);
+}
+
+FIntPoint UGroundHeightSubsystem::GetCellKey(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+bool UGroundHeightSubsystem::FindCachedHeight(const FIntPoint& Key, const FVector& Location, float ReferenceZ, bool& bOutHasGround, float& OutGroundZ) const
+{
+	const FGroundCell* Cell = Cells.Find(Key);
+	if (!Cell)
+	{
+		return false;
+	}
+
+	if (!Cell->bHasGround)
+	{
+		bOutHasGround = false;
+		return FMath::Abs(ReferenceZ - Cell->MissReferenceZ) <= MaxStepHeight;
+	}
+
+	// Height of the sample's plane at the queried point
+	const FVector& Normal = Cell->Normal;
+	const float GroundZ = Cell->Point.Z - (Normal.X * (Location.X - Cell->Point.X) + Normal.Y * (Location.Y - Cell->Point.Y)) / Normal.Z;
+	if (FMath::Abs(ReferenceZ - GroundZ) > MaxStepHeight)
+	{
+		return false;
+	}
+
+	bOutHasGround = true;
+	OutGroundZ = GroundZ;
+	return true;
+}
+
+void UGroundHeightSubsystem::StoreSample(const FIntPoint& Key, const FGroundCell& Cell)
+{
+	using namespace GroundHeightSubsystemPrivate;
+
+	// Steep samples would extrapolate badly across the column; those spots keep tracing
+	if (Cell.bHasGround && Cell.Normal.Z < MinCachedNormalZ)
+	{
+		return;
+	}
+
+	if (Cells.Num() >= MaxCachedCells && !Cells.Contains(Key))
+	{
+		UE_LOG(LogTemp, Log, TEXT("GroundHeightSubsystem::StoreSample - Cell cap reached (%d), clearing cache"), MaxCachedCells);
+		InvalidateAll();
+	}
+
+	Cells.Add(Key, Cell);
+	SET_DWORD_STAT(STAT_GroundHeightCells, Cells.Num());
+}
+
+void UGroundHeightSubsystem::HandleLevelChanged(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	// Levels without bounding content (or already emptied) invalidate everything
+	const FBox LevelBounds = Level ? ALevelBounds::CalculateLevelBounds(Level) : FBox(ForceInit);
+	if (!LevelBounds.IsValid)
+	{
+		InvalidateAll();
+		return;
+	}
+
+	const FIntPoint MinKey = GetCellKey(LevelBounds.Min);
+	const FIntPoint MaxKey = GetCellKey(LevelBounds.Max);
+	for (auto It = Cells.CreateIterator(); It; ++It)
+	{
+		const FIntPoint& Key = It.Key();
+		if (Key.X >= MinKey.X && Key.X <= MaxKey.X && Key.Y >= MinKey.Y && Key.Y <= MaxKey.Y)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Prefetches in flight may have sampled the old geometry
+	PendingCells.Empty();
+	CacheGeneration++;
+	SET_DWORD_STAT(STAT_GroundHeightCells, Cells.Num());
+}
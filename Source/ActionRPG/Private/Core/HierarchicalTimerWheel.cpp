@@ -0,0 +1,235 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Core/HierarchicalTimerWheel.h"
+
+FHierarchicalTimerWheel::FHierarchicalTimerWheel(double InTickInterval)
+	: TickInterval(FMath::Max(InTickInterval, 0.001))
+{
+	BucketHeads.Init(INDEX_NONE, NumLevels * SlotsPerLevel);
+}
+
+FTimerWheelHandle FHierarchicalTimerWheel::Schedule(double Delay, uint64 Payload)
+{
+	int32 NodeIndex = INDEX_NONE;
+	if (FreeNodes.Num() > 0)
+	{
+		NodeIndex = FreeNodes.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		NodeIndex = Nodes.AddDefaulted();
+	}
+
+	// Round up so a timer never fires early; always at least one tick away
+	const uint64 DelayTicks = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Max(Delay, 0.0) / TickInterval)));
+
+	FTimerNode& Node = Nodes[NodeIndex];
+	Node.ExpiryTick = CurrentTick + DelayTicks;
+	Node.Payload = Payload;
+	InsertNode(NodeIndex);
+	NumPending++;
+
+	FTimerWheelHandle Handle;
+	Handle.Index = NodeIndex;
+	Handle.Generation = Node.Generation;
+	return Handle;
+}
+
+bool FHierarchicalTimerWheel::IsPending(const FTimerWheelHandle& Handle) const
+{
+	return Nodes.IsValidIndex(Handle.Index)
+		&& Nodes[Handle.Index].Generation == Handle.Generation
+		&& Nodes[Handle.Index].Bucket != INDEX_NONE;
+}
+
+bool FHierarchicalTimerWheel::Cancel(FTimerWheelHandle& Handle)
+{
+	if (!IsPending(Handle))
+	{
+		Handle.Reset();
+		return false;
+	}
+
+	UnlinkNode(Handle.Index);
+	FreeNode(Handle.Index);
+	NumPending--;
+	Handle.Reset();
+	return true;
+}
+
+double FHierarchicalTimerWheel::GetTimeRemaining(const FTimerWheelHandle& Handle) const
+{
+	if (!IsPending(Handle))
+	{
+		return 0.0;
+	}
+
+	const double RemainingTicks = static_cast<double>(Nodes[Handle.Index].ExpiryTick - CurrentTick);
+	return FMath::Max(0.0, RemainingTicks * TickInterval - Accumulator);
+}
+
+void FHierarchicalTimerWheel::InsertNode(int32 NodeIndex)
+{
+	FTimerNode& Node = Nodes[NodeIndex];
+	const uint64 Delta = Node.ExpiryTick > CurrentTick ? Node.ExpiryTick - CurrentTick : 0;
+
+	// Pick the finest level whose range covers the delay
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+	{
+		Level++;
+	}
+
+	// Beyond the wheel's range - park in the last slot reachable at the top level; it cascades again later
+	uint64 Expiry = Node.ExpiryTick;
+	const uint64 MaxDelta = (uint64(1) << (SlotBits * NumLevels)) - 1;
+	if (Delta > MaxDelta)
+	{
+		Expiry = CurrentTick + MaxDelta;
+	}
+
+	const int32 Slot = static_cast<int32>((Expiry >> (SlotBits * Level)) & SlotMask);
+	const int32 Bucket = Level * SlotsPerLevel + Slot;
+
+	Node.Bucket = Bucket;
+	Node.Prev = INDEX_NONE;
+	Node.Next = BucketHeads[Bucket];
+	if (Node.Next != INDEX_NONE)
+	{
+		Nodes[Node.Next].Prev = NodeIndex;
+	}
+	BucketHeads[Bucket] = NodeIndex;
+}
+
+void FHierarchicalTimerWheel::UnlinkNode(int32 NodeIndex)
+{
+	FTimerNode& Node = Nodes[NodeIndex];
+	if (Node.Prev != INDEX_NONE)
+	{
+		Nodes[Node.Prev].Next = Node.Next;
+	}
+	else if (Node.Bucket != INDEX_NONE)
+	{
+		BucketHeads[Node.Bucket] = Node.Next;
+	}
+
+	if (Node.Next != INDEX_NONE)
+	{
+		Nodes[Node.Next].Prev = Node.Prev;
+	}
+
+	Node.Prev = INDEX_NONE;
+	Node.Next = INDEX_NONE;
+	Node.Bucket = INDEX_NONE;
+}
+
+void FHierarchicalTimerWheel::FreeNode(int32 NodeIndex)
+{
+	FTimerNode& Node = Nodes[NodeIndex];
+	Node.Generation++; // Invalidates outstanding handles
+	Node.Payload = 0;
+	FreeNodes.Add(NodeIndex);
+}
+
+void FHierarchicalTimerWheel::Cascade(int32 Level)
+{
+	const int32 Slot = static_cast<int32>((CurrentTick >> (SlotBits * Level)) & SlotMask);
+	const int32 Bucket = Level * SlotsPerLevel + Slot;
+
+	int32 NodeIndex = BucketHeads[Bucket];
+	BucketHeads[Bucket] = INDEX_NONE;
+
+	while (NodeIndex != INDEX_NONE)
+	{
+		const int32 NextIndex = Nodes[NodeIndex].Next;
+		InsertNode(NodeIndex);
+		NodeIndex = NextIndex;
+	}
+}
+
+void FHierarchicalTimerWheel::Step(TFunctionRef<void(uint64 Payload)> OnExpired)
+{
+	CurrentTick++;
+
+	// Whenever a level wraps, pull the matching bucket of the next level down
+	for (int32 Level = 1; Level < NumLevels; Level++)
+	{
+		if ((CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1)) != 0)
+		{
+			break;
+		}
+		Cascade(Level);
+	}
+
+	const int32 Bucket = static_cast<int32>(CurrentTick & SlotMask);
+	if (BucketHeads[Bucket] == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Detach the bucket first so callbacks can safely schedule/cancel
+	ExpiringNodes.Reset();
+	for (int32 NodeIndex = BucketHeads[Bucket]; NodeIndex != INDEX_NONE; NodeIndex = Nodes[NodeIndex].Next)
+	{
+		ExpiringNodes.Add(NodeIndex);
+	}
+
+	for (const int32 NodeIndex : ExpiringNodes)
+	{
+		// May have been cancelled by an earlier callback in this bucket
+		if (Nodes[NodeIndex].Bucket != Bucket)
+		{
+			continue;
+		}
+
+		if (Nodes[NodeIndex].ExpiryTick > CurrentTick)
+		{
+			// Parked beyond the wheel's range - re-insert for the remaining delay
+			UnlinkNode(NodeIndex);
+			InsertNode(NodeIndex);
+			continue;
+		}
+
+		const uint64 Payload = Nodes[NodeIndex].Payload;
+		UnlinkNode(NodeIndex);
+		FreeNode(NodeIndex);
+		NumPending--;
+
+		OnExpired(Payload);
+	}
+}
+
+void FHierarchicalTimerWheel::Advance(double DeltaTime, TFunctionRef<void(uint64 Payload)> OnExpired)
+{
+	Accumulator += FMath::Max(DeltaTime, 0.0);
+	while (Accumulator >= TickInterval)
+	{
+		Accumulator -= TickInterval;
+
+		// Nothing pending - skip whole ticks without walking buckets
+		if (NumPending == 0)
+		{
+			const uint64 SkippedTicks = static_cast<uint64>(Accumulator / TickInterval);
+			CurrentTick += SkippedTicks + 1;
+			Accumulator -= static_cast<double>(SkippedTicks) * TickInterval;
+			continue;
+		}
+
+		Step(OnExpired);
+	}
+}
+
+void FHierarchicalTimerWheel::Reset()
+{
+	for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); NodeIndex++)
+	{
+		if (Nodes[NodeIndex].Bucket != INDEX_NONE)
+		{
+			UnlinkNode(NodeIndex);
+			FreeNode(NodeIndex);
+		}
+	}
+
+	NumPending = 0;
+	Accumulator = 0.0;
+}
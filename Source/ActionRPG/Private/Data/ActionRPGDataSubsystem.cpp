@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Data/ActionRPGDataSubsystem.h"
+#include "Data/ItemDatabase.h"
+#include "Data/SkillDatabase.h"
+#include "Engine/GameInstance.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CoreDelegates.h"
+
+UActionRPGDataSubsystem* UActionRPGDataSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	const UGameInstance* GameInstance = Cast<UGameInstance>(WorldContextObject);
+	if (!GameInstance)
+	{
+		GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject);
+	}
+
+	return GameInstance ? GameInstance->GetSubsystem<UActionRPGDataSubsystem>() : nullptr;
+}
+
+void UActionRPGDataSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	InitTime = FPlatformTime::Seconds();
+	Timeline = FActionRPGStartupTimeline();
+	Timeline.GameInstanceInitTime = static_cast<float>(InitTime - GStartTime);
+	bTimelineReported = false;
+
+	UE_LOG(LogTemp, Log, TEXT("ActionRPGDataSubsystem: Initializing - starting async data loads (%.2fs after process start)"), Timeline.GameInstanceInitTime);
+
+	ItemDatabase = NewObject<UItemDatabase>(this);
+	SkillDatabase = NewObject<USkillDatabase>(this);
+
+	// Kick off both loads before either can complete (already-resident assets complete synchronously)
+	PendingDatabases = 2;
+	ItemDatabase->BeginLoad(FSimpleDelegate::CreateUObject(this, &UActionRPGDataSubsystem::HandleItemDatabaseLoaded));
+	SkillDatabase->BeginLoad(FSimpleDelegate::CreateUObject(this, &UActionRPGDataSubsystem::HandleSkillDatabaseLoaded));
+
+	// First frame = map loaded and the engine ticking
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &UActionRPGDataSubsystem::HandleEndFrame);
+}
+
+void UActionRPGDataSubsystem::Deinitialize()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	ItemDatabase = nullptr;
+	SkillDatabase = nullptr;
+	PendingDatabases = 0;
+
+	Super::Deinitialize();
+}
+
+float UActionRPGDataSubsystem::GetSecondsSinceInit() const
+{
+	return static_cast<float>(FPlatformTime::Seconds() - InitTime);
+}
+
+void UActionRPGDataSubsystem::HandleItemDatabaseLoaded()
+{
+	Timeline.ItemDataReadyTime = GetSecondsSinceInit();
+	HandleDatabaseLoaded();
+}
+
+void UActionRPGDataSubsystem::HandleSkillDatabaseLoaded()
+{
+	Timeline.SkillDataReadyTime = GetSecondsSinceInit();
+	HandleDatabaseLoaded();
+}
+
+void UActionRPGDataSubsystem::HandleDatabaseLoaded()
+{
+	if (PendingDatabases <= 0 || --PendingDatabases > 0)
+	{
+		return;
+	}
+
+	Timeline.DataReadyTime = GetSecondsSinceInit();
+	UE_LOG(LogTemp, Log, TEXT("ActionRPGDataSubsystem: All data ready (%.3fs after init)"), Timeline.DataReadyTime);
+
+	OnDataReady.Broadcast();
+	ReportTimelineIfComplete();
+}
+
+void UActionRPGDataSubsystem::HandleEndFrame()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	Timeline.FirstFrameTime = GetSecondsSinceInit();
+	ReportTimelineIfComplete();
+}
+
+void UActionRPGDataSubsystem::ReportTimelineIfComplete()
+{
+	if (bTimelineReported || Timeline.FirstFrameTime < 0.0f || Timeline.DataReadyTime < 0.0f)
+	{
+		return;
+	}
+	bTimelineReported = true;
+
+	UE_LOG(LogTemp, Log, TEXT("=== ActionRPG Startup Timeline ==="));
+	UE_LOG(LogTemp, Log, TEXT("  Game instance init: %.3fs after process start"), Timeline.GameInstanceInitTime);
+	UE_LOG(LogTemp, Log, TEXT("  Item data ready:    +%.3fs"), Timeline.ItemDataReadyTime);
+	UE_LOG(LogTemp, Log, TEXT("  Skill data ready:   +%.3fs"), Timeline.SkillDataReadyTime);
+	UE_LOG(LogTemp, Log, TEXT("  All data ready:     +%.3fs"), Timeline.DataReadyTime);
+	UE_LOG(LogTemp, Log, TEXT("  First frame:        +%.3fs"), Timeline.FirstFrameTime);
+	UE_LOG(LogTemp, Log, TEXT("  Data was %s the first frame"), Timeline.DataReadyTime <= Timeline.FirstFrameTime ? TEXT("ready before") : TEXT("still loading at"));
+}
@@ -1,190 +1,263 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Data/ItemDatabase.h"
+#include "Data/ActionRPGDataSubsystem.h"
 #include "Items/Core/ItemDataAsset.h"
 #include "Items/Core/ItemBase.h"
-#include "Engine/AssetManager.h"
-#include "Engine/StreamableManager.h"
+#include "Items/Core/ItemInstancePool.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
 #include "UObject/UObjectGlobals.h"
 
-UItemDatabase* UItemDatabase::Instance = nullptr;
+UItemDatabase* UItemDatabase::Get(const UObject* WorldContextObject)
+{
+	const UActionRPGDataSubsystem* DataSubsystem = UActionRPGDataSubsystem::Get(WorldContextObject);
+	return DataSubsystem ? DataSubsystem->GetItemDatabase() : nullptr;
+}
 
-UItemDatabase* UItemDatabase::Get()
+void UItemDatabase::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
-	if (!Instance)
-	{
-		Instance = NewObject<UItemDatabase>();
-		Instance->AddToRoot(); // Prevent garbage collection
-		Instance->Initialize();
-	}
-	return Instance;
+	Super::AddReferencedObjects(InThis, Collector);
+	CastChecked<UItemDatabase>(InThis)->Registry.AddReferencedObjects(Collector);
+}
+
+void UItemDatabase::BeginDestroy()
+{
+	UnregisterHotReloadHandlers();
+	Super::BeginDestroy();
 }
 
-void UItemDatabase::Initialize()
+void UItemDatabase::BeginLoad(FSimpleDelegate OnLoaded)
 {
 	// Clear existing registry
-	ItemRegistry.Empty();
+	Registry.Reset();
+	EffectTable.Reset();
+	bIsReady = false;
 
 	UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Initializing..."));
 
-	// Load all item data assets using Asset Manager
-	if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+	// Load all item data assets using Asset Manager (async, batched)
+	TWeakObjectPtr<UItemDatabase> WeakThis(this);
+	Registry.LoadAsync([WeakThis, OnLoaded]()
+	{
+		if (UItemDatabase* Database = WeakThis.Get())
+		{
+			Database->HandleLoadComplete(OnLoaded);
+		}
+	});
+}
+
+void UItemDatabase::HandleLoadComplete(FSimpleDelegate OnLoaded)
+{
+	// Compile effects for every registered item (RuntimeIndex was assigned by the registry)
+	Registry.ForEach([this](UItemDataAsset& ItemData)
+	{
+		EffectTable.CompileItem(ItemData);
+		UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Registered ItemDataAsset (template) - ID: %s, Name: %s, Index: %d"),
+			*ItemData.ItemID.ToString(), *ItemData.ItemName.ToString(), ItemData.RuntimeIndex);
+	});
+
+	UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Initialization complete. Registered %d ItemDataAssets (templates), %d compiled item effects."),
+		Registry.Num(), EffectTable.GetNumCompiledEffects());
+	UE_LOG(LogTemp, Log, TEXT("  ItemDatabase is owned by the game instance - stores ItemDataAssets (templates) shared by all players."));
+	UE_LOG(LogTemp, Log, TEXT("  Actual inventory items are stored in each player's InventoryComponent (unique per player)."));
+
+	// From here on, asset changes are patched in place instead of reloading everything
+	RegisterHotReloadHandlers();
+
+	bIsReady = true;
+	OnLoaded.ExecuteIfBound();
+}
+
+void UItemDatabase::RegisterHotReloadHandlers()
+{
+	if (AssetAddedHandle.IsValid())
+	{
+		return;
+	}
+
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
 	{
-		UE_LOG(LogTemp, Log, TEXT("ItemDatabase: AssetManager found, scanning for items..."));
-		
-		TArray<FPrimaryAssetId> ItemAssetIds;
-		AssetManager->GetPrimaryAssetIdList(FPrimaryAssetType("Item"), ItemAssetIds);
+		AssetAddedHandle = AssetRegistry->OnAssetAdded().AddUObject(this, &UItemDatabase::HandleAssetAdded);
+		AssetRemovedHandle = AssetRegistry->OnAssetRemoved().AddUObject(this, &UItemDatabase::HandleAssetRemoved);
+		AssetUpdatedHandle = AssetRegistry->OnAssetUpdated().AddUObject(this, &UItemDatabase::HandleAssetUpdated);
+	}
 
-		UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Found %d item assets to process"), ItemAssetIds.Num());
+#if WITH_EDITOR
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UItemDatabase::HandleObjectPropertyChanged);
+#endif
+}
 
-		if (ItemAssetIds.Num() == 0)
+void UItemDatabase::UnregisterHotReloadHandlers()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(AssetAddedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(AssetRemovedHandle);
+		AssetRegistry->OnAssetUpdated().Remove(AssetUpdatedHandle);
+	}
+	AssetAddedHandle.Reset();
+	AssetRemovedHandle.Reset();
+	AssetUpdatedHandle.Reset();
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	ObjectPropertyChangedHandle.Reset();
+#endif
+}
+
+bool UItemDatabase::RefreshItem(UItemDataAsset* ItemData)
+{
+	if (!ItemData)
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	const int32 PreviousIndex = Registry.IndexOf(*ItemData);
+	const FName PreviousID = Registry.GetKeyAt(PreviousIndex);
+
+	// A new asset with the ID of a registered one takes over that entry
+	const bool bReplacesEntry = PreviousIndex == INDEX_NONE && Registry.Find(ItemData->ItemID) != nullptr;
+
+	// Renamed onto an ID owned by another asset - that entry is replaced
+	if (PreviousIndex != INDEX_NONE && ItemData->ItemID != PreviousID)
+	{
+		if (UItemDataAsset* Displaced = Registry.Find(ItemData->ItemID))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: No items found! Check Asset Manager configuration:"));
-			UE_LOG(LogTemp, Warning, TEXT("  - Primary Asset Type 'Item' must be configured"));
-			UE_LOG(LogTemp, Warning, TEXT("  - Directory '/Game/Data/Items/' must be in scan list"));
-			UE_LOG(LogTemp, Warning, TEXT("  - Item Data Assets must have 'Item Type' set to 'Item'"));
+			RemoveItemEntry(Displaced->RuntimeIndex);
 		}
+	}
 
-		for (const FPrimaryAssetId& AssetId : ItemAssetIds)
+	const int32 ItemIndex = Registry.Refresh(*ItemData);
+	if (ItemIndex == INDEX_NONE)
+	{
+		// ItemID was cleared - drop the entry
+		if (PreviousIndex != INDEX_NONE)
 		{
-			// Load the asset first to ensure it's available (synchronous load)
-			TSharedPtr<FStreamableHandle> Handle = AssetManager->LoadPrimaryAsset(AssetId, TArray<FName>());
-			if (Handle.IsValid())
-			{
-				Handle->WaitUntilComplete();
-			}
-
-			// Get the asset object
-			UObject* AssetObject = AssetManager->GetPrimaryAssetObject(AssetId);
-			
-			if (!AssetObject)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: Failed to get asset object: %s"), *AssetId.ToString());
-				continue;
-			}
-
-			// Log the actual class name for debugging
-			FString ClassName = AssetObject->GetClass()->GetName();
-			FString ObjectName = AssetObject->GetName();
-			UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Found asset - ID: %s, Object: %s, Class: %s"), 
-				*AssetId.ToString(), *ObjectName, *ClassName);
-
-			// Check if it's a class instead of an instance (shouldn't happen, but just in case)
-			if (UClass* AssetClass = Cast<UClass>(AssetObject))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ItemDatabase: Asset is a class, not an instance! %s (Class: %s)"), 
-					*AssetId.ToString(), *AssetClass->GetName());
-				UE_LOG(LogTemp, Error, TEXT("  This usually means the asset was created as a Blueprint Class instead of a Data Asset."));
-				UE_LOG(LogTemp, Error, TEXT("  Solution: Delete the asset and recreate it as 'Data Asset' -> 'Item Data Asset'"));
-				continue;
-			}
-
-			// Try to cast to ItemDataAsset
-			UItemDataAsset* ItemData = Cast<UItemDataAsset>(AssetObject);
-			if (ItemData)
-			{
-				if (ItemData->ItemID != NAME_None)
-				{
-					ItemRegistry.Add(ItemData->ItemID, ItemData);
-					UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Registered ItemDataAsset (template) - ID: %s, Name: %s"), 
-						*ItemData->ItemID.ToString(), *ItemData->ItemName.ToString());
-					UE_LOG(LogTemp, Verbose, TEXT("  Note: ItemDatabase stores ItemDataAssets (templates), not actual inventory items."));
-					UE_LOG(LogTemp, Verbose, TEXT("  Actual inventory items are stored in each player's InventoryComponent."));
-				}
-				else
-				{
-					UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: Item Data Asset has empty ItemID: %s"), *AssetId.ToString());
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("ItemDatabase: Failed to cast asset to ItemDataAsset: %s"), *AssetId.ToString());
-				UE_LOG(LogTemp, Error, TEXT("  Object Name: %s"), *ObjectName);
-				UE_LOG(LogTemp, Error, TEXT("  Actual Class: %s"), *ClassName);
-				UE_LOG(LogTemp, Error, TEXT("  Expected Class: ItemDataAsset"));
-				UE_LOG(LogTemp, Error, TEXT("  This usually means:"));
-				UE_LOG(LogTemp, Error, TEXT("    1. Asset was created as Blueprint Class (wrong!)"));
-				UE_LOG(LogTemp, Error, TEXT("    2. Asset was created as regular DataAsset instead of ItemDataAsset"));
-				UE_LOG(LogTemp, Error, TEXT("    3. Asset needs to be recreated: Right-click -> Miscellaneous -> Data Asset -> Item Data Asset"));
-			}
+			EffectTable.RemoveItem(PreviousIndex);
+			OnItemDatabaseChanged.Broadcast(EItemDatabaseChange::Removed, PreviousID, PreviousIndex);
 		}
-
-		UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Initialization complete. Registered %d ItemDataAssets (templates)."), ItemRegistry.Num());
-		UE_LOG(LogTemp, Log, TEXT("  ItemDatabase is a SINGLETON - stores ItemDataAssets (templates) shared by all players."));
-		UE_LOG(LogTemp, Log, TEXT("  Actual inventory items are stored in each player's InventoryComponent (unique per player)."));
+		return false;
 	}
-	else
+
+	EffectTable.CompileItem(*ItemData);
+
+	const EItemDatabaseChange ChangeType = bReplacesEntry ? EItemDatabaseChange::Replaced
+		: (PreviousIndex == INDEX_NONE) ? EItemDatabaseChange::Added : EItemDatabaseChange::Updated;
+	UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Hot reload %s - ID: %s, Index: %d (%.3f ms)"),
+		bReplacesEntry ? TEXT("replaced") : (PreviousIndex == INDEX_NONE) ? TEXT("added") : TEXT("updated"),
+		*ItemData->ItemID.ToString(), ItemIndex, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	OnItemDatabaseChanged.Broadcast(ChangeType, ItemData->ItemID, ItemIndex);
+	return true;
+}
+
+void UItemDatabase::RemoveItemEntry(int32 ItemIndex)
+{
+	const FName ItemID = Registry.GetKeyAt(ItemIndex);
+	if (Registry.Unregister(ItemID) == INDEX_NONE)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ItemDatabase: AssetManager is not initialized!"));
-		UE_LOG(LogTemp, Error, TEXT("ItemDatabase: Items will need to be registered manually or Asset Manager must be configured."));
+		return;
 	}
+
+	EffectTable.RemoveItem(ItemIndex);
+
+	UE_LOG(LogTemp, Log, TEXT("ItemDatabase: Hot reload removed - ID: %s, Index: %d"), *ItemID.ToString(), ItemIndex);
+	OnItemDatabaseChanged.Broadcast(EItemDatabaseChange::Removed, ItemID, ItemIndex);
 }
 
-UItemDataAsset* UItemDatabase::GetItemDataAsset(const FName& ItemID) const
+void UItemDatabase::HandleAssetAdded(const FAssetData& AssetData)
 {
-	if (const TObjectPtr<UItemDataAsset>* FoundItem = ItemRegistry.Find(ItemID))
+	// The initial asset discovery also reports every asset as added - only react once it has finished
+	if (!AssetData.IsInstanceOf(UItemDataAsset::StaticClass()) || IAssetRegistry::GetChecked().IsLoadingAssets())
 	{
-		return *FoundItem;
+		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: Item not found: %s"), *ItemID.ToString());
-	return nullptr;
+	// Single asset load - this is the only item being read
+	RefreshItem(Cast<UItemDataAsset>(AssetData.GetAsset()));
 }
 
-TArray<UItemDataAsset*> UItemDatabase::GetAllItemDataAssets() const
+void UItemDatabase::HandleAssetRemoved(const FAssetData& AssetData)
 {
-	TArray<UItemDataAsset*> Items;
-	Items.Reserve(ItemRegistry.Num());
-	for (const auto& Pair : ItemRegistry)
+	if (!AssetData.IsInstanceOf(UItemDataAsset::StaticClass()))
 	{
-		if (Pair.Value)
-		{
-			Items.Add(Pair.Value);
-		}
+		return;
+	}
+
+	// Registered assets are always resident (the registry references them), so no load is needed
+	if (const UItemDataAsset* ItemData = Cast<UItemDataAsset>(AssetData.FastGetAsset(false)))
+	{
+		RemoveItemEntry(Registry.IndexOf(*ItemData));
 	}
-	return Items;
 }
 
-TArray<UItemDataAsset*> UItemDatabase::GetItemsByType(EItemType ItemType) const
+void UItemDatabase::HandleAssetUpdated(const FAssetData& AssetData)
 {
-	TArray<UItemDataAsset*> Items;
-	Items.Reserve(ItemRegistry.Num() / 4); // Reserve approximate size (assuming roughly 4 types)
-	for (const auto& Pair : ItemRegistry)
+	if (!AssetData.IsInstanceOf(UItemDataAsset::StaticClass()))
 	{
-		if (Pair.Value && Pair.Value->Type == ItemType)
-		{
-			Items.Add(Pair.Value);
-		}
+		return;
+	}
+
+	if (UItemDataAsset* ItemData = Cast<UItemDataAsset>(AssetData.FastGetAsset(false)))
+	{
+		RefreshItem(ItemData);
 	}
-	return Items;
 }
 
-TArray<UItemDataAsset*> UItemDatabase::GetItemsByRarity(EItemRarity Rarity) const
+#if WITH_EDITOR
+void UItemDatabase::HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent)
 {
-	TArray<UItemDataAsset*> Items;
-	Items.Reserve(ItemRegistry.Num() / 5); // Reserve approximate size (assuming roughly 5 rarities)
-	for (const auto& Pair : ItemRegistry)
+	// Ignore slider drags; patch once the edit is committed
+	if (PropertyChangedEvent.ChangeType == EPropertyChangeType::Interactive)
 	{
-		if (Pair.Value && Pair.Value->Rarity == Rarity)
-		{
-			Items.Add(Pair.Value);
-		}
+		return;
+	}
+
+	UItemDataAsset* ItemData = Cast<UItemDataAsset>(Object);
+	if (ItemData && !ItemData->HasAnyFlags(RF_ClassDefaultObject))
+	{
+		RefreshItem(ItemData);
 	}
-	return Items;
 }
+#endif
 
-TArray<FName> UItemDatabase::GetAllItemIDs() const
+UItemDataAsset* UItemDatabase::GetItemDataAsset(const FName& ItemID) const
 {
-	TArray<FName> ItemIDs;
-	ItemIDs.Reserve(ItemRegistry.Num());
-	for (const auto& Pair : ItemRegistry)
+	if (UItemDataAsset* FoundItem = Registry.Find(ItemID))
 	{
-		if (Pair.Value)
-		{
-			ItemIDs.Add(Pair.Value->ItemID);
-		}
+		return FoundItem;
 	}
-	return ItemIDs;
+
+	UE_LOG(LogTemp, Warning, TEXT("ItemDatabase: Item not found: %s"), *ItemID.ToString());
+	return nullptr;
+}
+
+TArray<UItemDataAsset*> UItemDatabase::GetAllItemDataAssets() const
+{
+	return Registry.GetAll();
+}
+
+UItemDataAsset* UItemDatabase::GetItemDataAssetByIndex(int32 ItemIndex) const
+{
+	return Registry.GetByIndex(ItemIndex);
+}
+
+TArray<UItemDataAsset*> UItemDatabase::GetItemsByType(EItemType ItemType) const
+{
+	return Registry.FindBy<FItemIndexByType>(ItemType);
+}
+
+TArray<UItemDataAsset*> UItemDatabase::GetItemsByRarity(EItemRarity Rarity) const
+{
+	return Registry.FindBy<FItemIndexByRarity>(Rarity);
+}
+
+TArray<FName> UItemDatabase::GetAllItemIDs() const
+{
+	return Registry.GetAllKeys();
 }
 
 void UItemDatabase::PrintAllItems() const
@@ -192,30 +265,28 @@ void UItemDatabase::PrintAllItems() const
 	UE_LOG(LogTemp, Log, TEXT("=== ItemDatabase: All Registered ItemDataAssets (Templates) ==="));
 	UE_LOG(LogTemp, Log, TEXT("Note: ItemDatabase stores ItemDataAssets (templates), NOT actual inventory items."));
 	UE_LOG(LogTemp, Log, TEXT("Actual inventory items are stored in each player's InventoryComponent."));
-	UE_LOG(LogTemp, Log, TEXT("Total ItemDataAssets: %d"), ItemRegistry.Num());
+	UE_LOG(LogTemp, Log, TEXT("Total ItemDataAssets: %d"), Registry.Num());
 	
-	if (ItemRegistry.Num() == 0)
+	if (Registry.Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("No items registered! Check Asset Manager configuration."));
 		return;
 	}
 
-	for (const auto& Pair : ItemRegistry)
+	Registry.ForEach([](const UItemDataAsset& ItemData)
 	{
-		if (Pair.Value)
-		{
-			UE_LOG(LogTemp, Log, TEXT("  - ID: %s | Name: %s | Type: %d | Rarity: %d"),
-				*Pair.Value->ItemID.ToString(),
-				*Pair.Value->ItemName.ToString(),
-				(int32)Pair.Value->Type,
-				(int32)Pair.Value->Rarity);
-		}
-	}
+		UE_LOG(LogTemp, Log, TEXT("  - ID: %s | Name: %s | Type: %d | Rarity: %d | Index: %d"),
+			*ItemData.ItemID.ToString(),
+			*ItemData.ItemName.ToString(),
+			(int32)ItemData.Type,
+			(int32)ItemData.Rarity,
+			ItemData.RuntimeIndex);
+	});
 	
 	UE_LOG(LogTemp, Log, TEXT("=== End Item List ==="));
 }
 
-UItemBase* UItemDatabase::CreateItem(const FName& ItemID, int32 Quantity) const
+UItemBase* UItemDatabase::CreateItem(const FName& ItemID, int32 Quantity, const UObject* WorldContextObject) const
 {
 	UE_LOG(LogTemp, Verbose, TEXT("ItemDatabase::CreateItem - Creating item instance (NOT storing in database): %s (Quantity: %d)"), 
 		*ItemID.ToString(), Quantity);
@@ -227,6 +298,12 @@ UItemBase* UItemDatabase::CreateItem(const FName& ItemID, int32 Quantity) const
 		return nullptr;
 	}
 
+	// Reuse a pooled instance when the caller's world has an item pool
+	if (UItemInstancePool* Pool = UItemInstancePool::Get(WorldContextObject))
+	{
+		return Pool->Acquire(ItemData, Quantity);
+	}
+
 	// Create a new item instance - this is NOT stored in the database
 	// The database only stores ItemDataAssets (templates), not actual inventory items
 	// Actual items are stored in the player's InventoryComponent
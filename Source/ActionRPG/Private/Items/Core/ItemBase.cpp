@@ -48,3 +48,10 @@ EItemType UItemBase::GetItemType() const
 	return ItemData ? ItemData->Type : EItemType::Misc;
 }
 
+void UItemBase::ResetItem()
+{
+	ItemData = nullptr;
+	Quantity = 1;
+	OnItemUsed.Clear();
+}
+
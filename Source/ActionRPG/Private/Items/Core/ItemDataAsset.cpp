@@ -11,11 +11,15 @@ UItemDataAsset::UItemDataAsset()
 	ItemDescription = FText::GetEmpty();
 	ItemIcon = nullptr;
 	ItemPickupActorClass = nullptr;
+	WorldMesh = nullptr;
 	Type = EItemType::Misc;
 	Rarity = EItemRarity::Common;
 	MaxStackSize = 1;
 	Weight = 0.0f;
 	Value = 0;
+	CooldownDuration = 0.0f;
+	CooldownGroup = NAME_None;
+	RuntimeIndex = INDEX_NONE;
 }
 
 FPrimaryAssetId UItemDataAsset::GetPrimaryAssetId() const
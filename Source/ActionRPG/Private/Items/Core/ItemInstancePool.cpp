@@ -0,0 +1,130 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Items/Core/ItemInstancePool.h"
+#include "Items/Core/ItemBase.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Pool Hits"), STAT_ItemPoolHits, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Item Pool Misses"), STAT_ItemPoolMisses, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Item Pool Free"), STAT_ItemPoolFree, STATGROUP_ActionRPG);
+
+UItemInstancePool* UItemInstancePool::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UItemInstancePool>() : nullptr;
+}
+
+bool UItemInstancePool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UItemInstancePool::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Stats = FItemInstancePoolStats();
+	FreeItems.Reserve(FMath::Max(PrewarmCount, 0));
+	Prewarm(PrewarmCount);
+
+	UE_LOG(LogTemp, Log, TEXT("ItemInstancePool: Initialized - pre-warmed %d item instances (Max pooled: %d)"), FreeItems.Num(), MaxPooledItems);
+}
+
+void UItemInstancePool::Deinitialize()
+{
+	ReportStats();
+
+	FreeItems.Empty();
+	SET_DWORD_STAT(STAT_ItemPoolFree, 0);
+
+	Super::Deinitialize();
+}
+
+UItemBase* UItemInstancePool::CreateInstance()
+{
+	// Pool is the outer so instances live as long as the world, independent of which inventory holds them
+	return NewObject<UItemBase>(this, UItemBase::StaticClass());
+}
+
+UItemBase* UItemInstancePool::Acquire(UItemDataAsset* ItemData, int32 Quantity)
+{
+	UItemBase* Item = nullptr;
+
+	if (FreeItems.Num() > 0)
+	{
+		Item = FreeItems.Pop(EAllowShrinking::No);
+		Item->bInItemPool = false;
+		Stats.Hits++;
+		INC_DWORD_STAT(STAT_ItemPoolHits);
+	}
+	else
+	{
+		Item = CreateInstance();
+		Stats.Misses++;
+		INC_DWORD_STAT(STAT_ItemPoolMisses);
+	}
+
+	Stats.FreeCount = FreeItems.Num();
+	SET_DWORD_STAT(STAT_ItemPoolFree, FreeItems.Num());
+
+	Item->ItemData = ItemData;
+	Item->Quantity = FMath::Max(1, Quantity);
+	return Item;
+}
+
+void UItemInstancePool::Release(UItemBase* Item)
+{
+	if (!Item || Item->bInItemPool)
+	{
+		return;
+	}
+
+	Item->ResetItem();
+	Stats.Releases++;
+
+	if (FreeItems.Num() >= MaxPooledItems)
+	{
+		// Pool is full - leave the instance to GC
+		Stats.Discards++;
+		return;
+	}
+
+	Item->bInItemPool = true;
+	FreeItems.Add(Item);
+
+	Stats.FreeCount = FreeItems.Num();
+	Stats.PeakFreeCount = FMath::Max(Stats.PeakFreeCount, Stats.FreeCount);
+	SET_DWORD_STAT(STAT_ItemPoolFree, FreeItems.Num());
+}
+
+void UItemInstancePool::Prewarm(int32 Count)
+{
+	const int32 Target = FMath::Min(Count, MaxPooledItems);
+	while (FreeItems.Num() < Target)
+	{
+		UItemBase* Item = CreateInstance();
+		Item->bInItemPool = true;
+		FreeItems.Add(Item);
+	}
+
+	Stats.FreeCount = FreeItems.Num();
+	Stats.PeakFreeCount = FMath::Max(Stats.PeakFreeCount, Stats.FreeCount);
+	SET_DWORD_STAT(STAT_ItemPoolFree, FreeItems.Num());
+}
+
+void UItemInstancePool::ReportStats() const
+{
+	const int32 TotalAcquires = Stats.Hits + Stats.Misses;
+	const float HitRate = TotalAcquires > 0 ? (100.0f * Stats.Hits / TotalAcquires) : 0.0f;
+
+	UE_LOG(LogTemp, Log, TEXT("ItemInstancePool: Hits: %d | Misses: %d | Hit Rate: %.1f%% | Releases: %d | Discards: %d | Free: %d (Peak: %d)"),
+		Stats.Hits, Stats.Misses, HitRate, Stats.Releases, Stats.Discards, Stats.FreeCount, Stats.PeakFreeCount);
+}
@@ -0,0 +1,199 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Items/Effects/ItemEffectTable.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "StatusEffects/StatusEffectSubsystem.h"
+
+namespace ItemEffectHandlers
+{
+	template<EActionRPGAttribute Attribute>
+	static bool CanRestoreAttribute(AActor& Target, const FItemEffectParams& Params)
+	{
+		const UAttributeComponent* Attributes = UAttributeComponent::FindAttributeComponent(&Target);
+		return Attributes && Params.Magnitude > 0.0f && !Attributes->IsAtMax(Attribute);
+	}
+
+	template<EActionRPGAttribute Attribute>
+	static void RestoreAttribute(AActor& Target, const FItemEffectParams& Params)
+	{
+		if (UAttributeComponent* Attributes = UAttributeComponent::FindAttributeComponent(&Target))
+		{
+			Attributes->ModifyValue(Attribute, Params.Magnitude);
+		}
+	}
+
+	static bool CanApplyStatusEffect(AActor& Target, const FItemEffectParams& Params)
+	{
+		return Params.StatusEffect && UStatusEffectSubsystem::Get(&Target);
+	}
+
+	static void ApplyStatusEffect(AActor& Target, const FItemEffectParams& Params)
+	{
+		if (UStatusEffectSubsystem* StatusEffects = UStatusEffectSubsystem::Get(&Target))
+		{
+			StatusEffects->ApplyStatusEffect(&Target, Params.StatusEffect, FMath::Max(FMath::RoundToInt32(Params.Magnitude), 1));
+		}
+	}
+}
+
+void FItemEffectTable::Reset()
+{
+	Ranges.Reset();
+	Effects.Reset();
+	NumStaleEffects = 0;
+}
+
+bool FItemEffectTable::ResolveHandlers(EItemEffectType EffectType, FCanApplyFn& OutCanApply, FApplyFn& OutApply)
+{
+	switch (EffectType)
+	{
+	case EItemEffectType::RestoreHealth:
+		OutCanApply = &ItemEffectHandlers::CanRestoreAttribute<EActionRPGAttribute::Health>;
+		OutApply = &ItemEffectHandlers::RestoreAttribute<EActionRPGAttribute::Health>;
+		return true;
+
+	case EItemEffectType::RestoreMana:
+		OutCanApply = &ItemEffectHandlers::CanRestoreAttribute<EActionRPGAttribute::Mana>;
+		OutApply = &ItemEffectHandlers::RestoreAttribute<EActionRPGAttribute::Mana>;
+		return true;
+
+	case EItemEffectType::RestoreStamina:
+		OutCanApply = &ItemEffectHandlers::CanRestoreAttribute<EActionRPGAttribute::Stamina>;
+		OutApply = &ItemEffectHandlers::RestoreAttribute<EActionRPGAttribute::Stamina>;
+		return true;
+
+	case EItemEffectType::ApplyStatusEffect:
+		OutCanApply = &ItemEffectHandlers::CanApplyStatusEffect;
+		OutApply = &ItemEffectHandlers::ApplyStatusEffect;
+		return true;
+
+	case EItemEffectType::None:
+	default:
+		return false;
+	}
+}
+
+void FItemEffectTable::CompileItem(const UItemDataAsset& ItemData)
+{
+	const int32 ItemIndex = ItemData.RuntimeIndex;
+	if (ItemIndex == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ItemEffectTable::CompileItem - Item %s has no RuntimeIndex, skipping"), *ItemData.ItemID.ToString());
+		return;
+	}
+
+	if (!Ranges.IsValidIndex(ItemIndex))
+	{
+		Ranges.SetNum(ItemIndex + 1);
+	}
+
+	// Legacy content: health potions authored before effect definitions existed heal 25
+	TArray<FItemEffectDefinition, TInlineAllocator<4>> Definitions(ItemData.Effects);
+	if (Definitions.Num() == 0 && ItemData.Type == EItemType::Consumable && ItemData.ItemID == FName("HealthPotion"))
+	{
+		Definitions.Emplace(EItemEffectType::RestoreHealth, 25.0f);
+		UE_LOG(LogTemp, Log, TEXT("ItemEffectTable::CompileItem - %s has no Effects authored, using legacy RestoreHealth 25"), *ItemData.ItemID.ToString());
+	}
+
+	FEffectRange& Range = Ranges[ItemIndex];
+	NumStaleEffects += Range.Num;
+	Range.First = Effects.Num();
+	Range.Num = 0;
+
+	for (const FItemEffectDefinition& Definition : Definitions)
+	{
+		FCompiledEffect Compiled;
+		if (!ResolveHandlers(Definition.EffectType, Compiled.CanApply, Compiled.Apply))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ItemEffectTable::CompileItem - Item %s has an effect with no handler (Type: %d)"),
+				*ItemData.ItemID.ToString(), (int32)Definition.EffectType);
+			continue;
+		}
+
+		Compiled.Params.Magnitude = Definition.Magnitude;
+		Compiled.Params.StatusEffect = Definition.StatusEffect;
+		Compiled.bBlockUseWhenIneffective = Definition.bBlockUseWhenIneffective;
+		Effects.Add(Compiled);
+		Range.Num++;
+	}
+
+	// Hot reloads append; compact once orphaned entries dominate the table
+	if (NumStaleEffects > 32 && NumStaleEffects > Effects.Num() / 2)
+	{
+		Compact();
+	}
+}
+
+void FItemEffectTable::RemoveItem(int32 ItemIndex)
+{
+	if (Ranges.IsValidIndex(ItemIndex))
+	{
+		NumStaleEffects += Ranges[ItemIndex].Num;
+		Ranges[ItemIndex] = FEffectRange();
+	}
+}
+
+void FItemEffectTable::Compact()
+{
+	TArray<FCompiledEffect> CompactedEffects;
+	CompactedEffects.Reserve(Effects.Num() - NumStaleEffects);
+
+	for (FEffectRange& Range : Ranges)
+	{
+		const int32 NewFirst = CompactedEffects.Num();
+		CompactedEffects.Append(Effects.GetData() + Range.First, Range.Num);
+		Range.First = NewFirst;
+	}
+
+	Effects = MoveTemp(CompactedEffects);
+	NumStaleEffects = 0;
+}
+
+bool FItemEffectTable::HasEffects(int32 ItemIndex) const
+{
+	return Ranges.IsValidIndex(ItemIndex) && Ranges[ItemIndex].Num > 0;
+}
+
+bool FItemEffectTable::CanApply(int32 ItemIndex, AActor* Target) const
+{
+	if (!Target || !HasEffects(ItemIndex))
+	{
+		// Items without effects are always usable (their use is handled elsewhere)
+		return true;
+	}
+
+	const FEffectRange& Range = Ranges[ItemIndex];
+	for (int32 i = Range.First; i < Range.First + Range.Num; i++)
+	{
+		const FCompiledEffect& Effect = Effects[i];
+		if (Effect.bBlockUseWhenIneffective && !Effect.CanApply(*Target, Effect.Params))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FItemEffectTable::Apply(int32 ItemIndex, AActor* Target) const
+{
+	if (!Target || !HasEffects(ItemIndex))
+	{
+		return false;
+	}
+
+	bool bApplied = false;
+	const FEffectRange& Range = Ranges[ItemIndex];
+	for (int32 i = Range.First; i < Range.First + Range.Num; i++)
+	{
+		const FCompiledEffect& Effect = Effects[i];
+		if (Effect.CanApply(*Target, Effect.Params))
+		{
+			Effect.Apply(*Target, Effect.Params);
+			bApplied = true;
+		}
+	}
+
+	return bApplied;
+}
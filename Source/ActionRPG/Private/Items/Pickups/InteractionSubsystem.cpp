@@ -0,0 +1,344 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Items/Pickups/InteractionSubsystem.h"
+#include "Items/Pickups/ItemPickupActor.h"
+#include "Items/Pickups/WorldItemSubsystem.h"
+#include "Core/ActionRPGStats.h"
+#include "Core/GameplayTraceSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("Interaction Candidates"), STAT_InteractionCandidates, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Interaction Hover"), STAT_InteractionHover, STATGROUP_ActionRPG);
+
+UInteractionSubsystem* UInteractionSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+}
+
+bool UInteractionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UInteractionSubsystem::Deinitialize()
+{
+	PlayerStates.Empty();
+	PickupResults.Empty();
+	WorldItemResults.Empty();
+	GatheredCandidates.Empty();
+
+	Super::Deinitialize();
+}
+
+void UInteractionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Forget players that left
+	for (auto It = PlayerStates.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Only local players have a cursor
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!Pawn || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FPlayerInteractionState& State = PlayerStates.FindOrAdd(PlayerController);
+		State.TimeUntilRefresh -= DeltaTime;
+		if (State.TimeUntilRefresh <= 0.0f)
+		{
+			RefreshCandidates(*PlayerController, *Pawn, State);
+			State.TimeUntilRefresh = CandidateRefreshInterval;
+		}
+
+		RequestCursorTrace(*PlayerController, State);
+		UpdateHoverTarget(*PlayerController, *Pawn, State);
+	}
+}
+
+TStatId UInteractionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionSubsystem, STATGROUP_Tickables);
+}
+
+bool UInteractionSubsystem::GetHoverTarget(const APlayerController* PlayerController, FVector& OutLocation) const
+{
+	const FPlayerInteractionState* State = PlayerStates.Find(PlayerController);
+	if (!State || !State->Candidates.IsValidIndex(State->HoverIndex))
+	{
+		return false;
+	}
+
+	const FInteractionCandidate& Candidate = State->Candidates[State->HoverIndex];
+	const AItemPickupActor* Pickup = Candidate.Pickup.Get();
+	OutLocation = Pickup ? Pickup->GetActorLocation() : Candidate.Location;
+	return true;
+}
+
+AItemPickupActor* UInteractionSubsystem::ResolveInteractTarget(APlayerController* PlayerController, bool& bOutMaterialized)
+{
+	bOutMaterialized = false;
+
+	const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (!Pawn)
+	{
+		return nullptr;
+	}
+
+	// Normally the cached hover target; a player the tick hasn't seen yet is resolved right now
+	FPlayerInteractionState& State = FindOrAddState(*PlayerController);
+	if (!State.Candidates.IsValidIndex(State.HoverIndex))
+	{
+		return nullptr;
+	}
+
+	const FInteractionCandidate Candidate = State.Candidates[State.HoverIndex];
+	if (Candidate.WorldItemId == INDEX_NONE)
+	{
+		AItemPickupActor* Pickup = Candidate.Pickup.Get();
+		return Pickup && !Pickup->IsInPickupPool() ? Pickup : nullptr;
+	}
+
+	// The entry may have been collected (and its id reused) since the refresh
+	UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this);
+	FVector EntryLocation;
+	float EntryInteractionRange = 0.0f;
+	if (!WorldItems || !WorldItems->GetWorldItemInfo(Candidate.WorldItemId, EntryLocation, EntryInteractionRange)
+		|| !EntryLocation.Equals(Candidate.Location))
+	{
+		State.TimeUntilRefresh = 0.0f;
+		return nullptr;
+	}
+
+	// The stored item becomes an actor now; refresh so the list holds it instead of the entry
+	AItemPickupActor* Pickup = WorldItems->MaterializeWorldItem(Candidate.WorldItemId);
+	State.TimeUntilRefresh = 0.0f;
+	State.HoverIndex = INDEX_NONE;
+	bOutMaterialized = Pickup != nullptr;
+	return Pickup;
+}
+
+UInteractionSubsystem::FPlayerInteractionState& UInteractionSubsystem::FindOrAddState(APlayerController& PlayerController)
+{
+	if (FPlayerInteractionState* State = PlayerStates.Find(&PlayerController))
+	{
+		return *State;
+	}
+
+	FPlayerInteractionState& State = PlayerStates.Add(&PlayerController);
+	if (const APawn* Pawn = PlayerController.GetPawn())
+	{
+		RefreshCandidates(PlayerController, *Pawn, State);
+		State.TimeUntilRefresh = CandidateRefreshInterval;
+		UpdateHoverTarget(PlayerController, *Pawn, State);
+	}
+	return State;
+}
+
+void UInteractionSubsystem::RefreshCandidates(const APlayerController& PlayerController, const APawn& Pawn, FPlayerInteractionState& State)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionCandidates);
+
+	State.Candidates.Reset();
+	State.HoverIndex = INDEX_NONE;
+
+	const UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this);
+	if (!WorldItems)
+	{
+		return;
+	}
+
+	const FVector PawnLocation = Pawn.GetActorLocation();
+	const FVector2D Pawn2D(PawnLocation);
+	FVector2D Cursor2D;
+	const bool bHasCursor = GetCursorPoint(PlayerController, Pawn, State, Cursor2D);
+
+	// Grid results come in cell order, so gather widely and keep the nearest
+	GatheredCandidates.Reset();
+	PickupResults.SetNumUninitialized(MaxGatheredCandidates, EAllowShrinking::No);
+	const int32 NumPickups = WorldItems->QueryPickupsInRadius(PawnLocation, CandidateRadius, PickupResults);
+	for (int32 Index = 0; Index < NumPickups; Index++)
+	{
+		AItemPickupActor* Pickup = PickupResults[Index];
+		FInteractionCandidate& Candidate = GatheredCandidates.AddDefaulted_GetRef();
+		Candidate.Pickup = Pickup;
+		Candidate.Location = Pickup->GetActorLocation();
+		Candidate.InteractionRange = Pickup->GetInteractionRange();
+	}
+	KeepNearestCandidates(GatheredCandidates, MaxCandidates, Pawn2D, bHasCursor ? &Cursor2D : nullptr, State);
+
+	// Stored items have their own budget, so a crowd of actors can't push them out
+	GatheredCandidates.Reset();
+	WorldItemResults.SetNumUninitialized(MaxGatheredCandidates, EAllowShrinking::No);
+	const int32 NumWorldItems = WorldItems->QueryWorldItemsInRadius(PawnLocation, CandidateRadius, WorldItemResults);
+	for (int32 Index = 0; Index < NumWorldItems; Index++)
+	{
+		FInteractionCandidate Candidate;
+		Candidate.WorldItemId = WorldItemResults[Index];
+		if (WorldItems->GetWorldItemInfo(Candidate.WorldItemId, Candidate.Location, Candidate.InteractionRange))
+		{
+			GatheredCandidates.Add(Candidate);
+		}
+	}
+	KeepNearestCandidates(GatheredCandidates, MaxStoredCandidates, Pawn2D, bHasCursor ? &Cursor2D : nullptr, State);
+}
+
+void UInteractionSubsystem::KeepNearestCandidates(TArray<FInteractionCandidate>& Gathered, int32 Budget, const FVector2D& Pawn2D,
+	const FVector2D* Cursor2D, FPlayerInteractionState& State) const
+{
+	if (Gathered.Num() > Budget)
+	{
+		// Nearest to either the pawn (in range) or the cursor (pointed at) - both kinds of hover target survive
+		auto RankDistanceSq = [&Pawn2D, Cursor2D](const FInteractionCandidate& Candidate)
+		{
+			const FVector2D Location2D(Candidate.Location);
+			const double PawnDistanceSq = FVector2D::DistSquared(Pawn2D, Location2D);
+			return Cursor2D ? FMath::Min(PawnDistanceSq, FVector2D::DistSquared(*Cursor2D, Location2D)) : PawnDistanceSq;
+		};
+
+		Gathered.Sort([&RankDistanceSq](const FInteractionCandidate& A, const FInteractionCandidate& B)
+		{
+			return RankDistanceSq(A) < RankDistanceSq(B);
+		});
+	}
+
+	State.Candidates.Append(Gathered.GetData(), FMath::Min(Gathered.Num(), Budget));
+}
+
+bool UInteractionSubsystem::GetCursorPoint(const APlayerController& PlayerController, const APawn& Pawn, const FPlayerInteractionState& State, FVector2D& OutCursor2D) const
+{
+	// Pickups have no collision - the cursor point is the traced ground under the cursor, or the
+	// cursor ray projected onto the ground plane at the pawn's feet until a trace has hit
+	FVector CursorOrigin;
+	FVector CursorDirection;
+	if (!PlayerController.DeprojectMousePositionToWorld(CursorOrigin, CursorDirection))
+	{
+		return false;
+	}
+
+	if (State.bHasCursorGround)
+	{
+		OutCursor2D = FVector2D(State.CursorGroundPoint);
+		return true;
+	}
+
+	if (FMath::Abs(CursorDirection.Z) <= UE_KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	OutCursor2D = FVector2D(FMath::RayPlaneIntersection(CursorOrigin, CursorDirection, FPlane(Pawn.GetActorLocation(), FVector::UpVector)));
+	return true;
+}
+
+void UInteractionSubsystem::RequestCursorTrace(const APlayerController& PlayerController, FPlayerInteractionState& State)
+{
+	// One trace in flight per player; its result is at most a frame old when the next one goes out
+	UGameplayTraceSubsystem* Traces = UGameplayTraceSubsystem::Get(this);
+	FVector CursorOrigin;
+	FVector CursorDirection;
+	if (State.bCursorTracePending || !Traces || !PlayerController.DeprojectMousePositionToWorld(CursorOrigin, CursorDirection))
+	{
+		return;
+	}
+
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(InteractionCursor), false, PlayerController.GetPawn());
+	State.bCursorTracePending = true;
+	Traces->RequestLineTrace(CursorOrigin, CursorOrigin + CursorDirection * CursorTraceLength, ECC_Visibility, Params,
+		[WeakThis = TWeakObjectPtr<UInteractionSubsystem>(this), PlayerKey = TObjectKey<APlayerController>(&PlayerController)](bool bBlockingHit, const FHitResult& Hit)
+		{
+			UInteractionSubsystem* This = WeakThis.Get();
+			FPlayerInteractionState* PlayerState = This ? This->PlayerStates.Find(PlayerKey) : nullptr;
+			if (!PlayerState)
+			{
+				return;
+			}
+
+			PlayerState->bCursorTracePending = false;
+			PlayerState->bHasCursorGround = bBlockingHit;
+			if (bBlockingHit)
+			{
+				PlayerState->CursorGroundPoint = Hit.ImpactPoint;
+			}
+		});
+}
+
+void UInteractionSubsystem::UpdateHoverTarget(const APlayerController& PlayerController, const APawn& Pawn, FPlayerInteractionState& State) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionHover);
+
+	State.HoverIndex = INDEX_NONE;
+	if (State.Candidates.Num() == 0)
+	{
+		return;
+	}
+
+	FVector2D Cursor2D = FVector2D::ZeroVector;
+	const bool bHasCursor = GetCursorPoint(PlayerController, Pawn, State, Cursor2D);
+	const FVector2D Pawn2D(Pawn.GetActorLocation());
+
+	double BestCursorDistanceSq = FMath::Square(static_cast<double>(CursorPickupRadius));
+	double BestRangeDistanceSq = TNumericLimits<double>::Max();
+	int32 CursorIndex = INDEX_NONE;
+	int32 RangeIndex = INDEX_NONE;
+
+	for (int32 Index = 0; Index < State.Candidates.Num(); Index++)
+	{
+		FInteractionCandidate& Candidate = State.Candidates[Index];
+		if (Candidate.WorldItemId == INDEX_NONE)
+		{
+			// Picked up or pooled since the refresh
+			const AItemPickupActor* Pickup = Candidate.Pickup.Get();
+			if (!Pickup || Pickup->IsInPickupPool())
+			{
+				continue;
+			}
+			Candidate.Location = Pickup->GetActorLocation();
+		}
+
+		const FVector2D Location2D(Candidate.Location);
+		if (bHasCursor)
+		{
+			const double CursorDistanceSq = FVector2D::DistSquared(Cursor2D, Location2D);
+			if (CursorDistanceSq <= BestCursorDistanceSq)
+			{
+				BestCursorDistanceSq = CursorDistanceSq;
+				CursorIndex = Index;
+			}
+		}
+
+		const double RangeDistanceSq = FVector2D::DistSquared(Pawn2D, Location2D);
+		if (RangeDistanceSq <= FMath::Square(static_cast<double>(Candidate.InteractionRange)) && RangeDistanceSq < BestRangeDistanceSq)
+		{
+			BestRangeDistanceSq = RangeDistanceSq;
+			RangeIndex = Index;
+		}
+	}
+
+	State.HoverIndex = CursorIndex != INDEX_NONE ? CursorIndex : RangeIndex;
+}
@@ -6,58 +6,87 @@
 #include "Data/ItemDatabase.h"
 #include "Items/Core/ItemBase.h"
 #include "Items/Core/ItemDataAsset.h"
+#include "Items/Core/ItemInstancePool.h"
 #include "Items/Core/ItemTypes.h"
+#include "Items/Pickups/WorldItemSubsystem.h"
+#include "Items/Pickups/PickupActorPool.h"
+#include "Items/Pickups/LootLifetimeSubsystem.h"
 #include "Components/SceneComponent.h"
 #include "Engine/Engine.h"
 #include "Engine/StaticMesh.h"
+#include "Net/UnrealNetwork.h"
 
 AItemPickupActor::AItemPickupActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
-	// Create collision component as root (better for overlap detection)
+	// Sphere stays as root (editor visualisation of the pickup radius) but has no collision -
+	// pickups are found through the World Item Subsystem's grid instead of overlaps
 	CollisionComponent = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionComponent"));
 	RootComponent = CollisionComponent;
 	CollisionComponent->SetSphereRadius(50.0f);
-	
-	// Set collision settings for overlap detection
-	CollisionComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-	CollisionComponent->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
+	CollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	CollisionComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
-	CollisionComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-	
-	// Ensure collision is generated
-	CollisionComponent->SetGenerateOverlapEvents(true);
+	CollisionComponent->SetGenerateOverlapEvents(false);
 
 	// Create mesh component for visual representation
 	MeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeshComponent"));
 	MeshComponent->SetupAttachment(CollisionComponent);
 	MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	MeshComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+
+	// Replicated, but dormant until flushed - replication cost follows changes, not pickup count.
+	// Movement replicates so pooled pickups show up at their new drop location.
+	bReplicates = true;
+	SetReplicatingMovement(true);
+	NetDormancy = DORM_Initial;
+	SetNetCullDistanceSquared(FMath::Square(PickupNetCullDistance));
+}
+
+void AItemPickupActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AItemPickupActor, ItemData);
+	DOREPLIFETIME(AItemPickupActor, Quantity);
+}
+
+bool AItemPickupActor::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	// Waiting in the pickup pool - clients have nothing to show
+	if (bInPickupPool)
+	{
+		return false;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
 }
 
 void AItemPickupActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Ensure collision component is valid and registered
+	// Blueprint subclasses may have turned collision back on - pickups rely on the world item grid
 	if (CollisionComponent)
 	{
-		// Verify collision settings
-		CollisionComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-		CollisionComponent->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
-		CollisionComponent->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-		CollisionComponent->SetGenerateOverlapEvents(true);
-		
-		// Bind overlap event
-		CollisionComponent->OnComponentBeginOverlap.AddDynamic(this, &AItemPickupActor::OnOverlapBegin);
-		
-		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor: BeginPlay - CollisionComponent configured, Sphere Radius: %.2f"), 
-		       CollisionComponent->GetScaledSphereRadius());
+		CollisionComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		CollisionComponent->SetGenerateOverlapEvents(false);
 	}
-	else
+
+	// Blueprint defaults may change the cull distance
+	SetNetCullDistanceSquared(FMath::Square(PickupNetCullDistance));
+
+	// Pre-warmed by the pickup pool - stays inactive until acquired
+	if (bInPickupPool)
+	{
+		SetActorHiddenInGame(true);
+		return;
+	}
+
+	// Make this pickup visible to interaction and auto-pickup queries
+	if (UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ItemPickupActor: BeginPlay - CollisionComponent is NULL!"));
+		WorldItems->RegisterPickup(this);
 	}
 
 	// Setup visuals
@@ -75,44 +104,6 @@ void AItemPickupActor::BeginPlay()
 	}
 }
 
-void AItemPickupActor::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-                                      UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-                                      bool bFromSweep, const FHitResult& SweepResult)
-{
-	UE_LOG(LogTemp, Log, TEXT("ItemPickupActor: OnOverlapBegin called - OtherActor: %s"), 
-	       OtherActor ? *OtherActor->GetName() : TEXT("NULL"));
-
-	// Cast to player character
-	if (AActionRPGPlayerCharacter* Player = Cast<AActionRPGPlayerCharacter>(OtherActor))
-	{
-		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor: Player overlapped - %s (Player: %s)"), 
-		       *GetName(), *Player->GetName());
-
-		// Only auto-pickup if enabled
-		if (bAutoPickupOnOverlap)
-		{
-			// Check if pickup is valid
-			if (CanPickup(Player))
-			{
-				PickupItem(Player);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("ItemPickupActor: Cannot pickup item - validation failed"));
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Verbose, TEXT("ItemPickupActor: Auto-pickup disabled - player must press interact key"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Verbose, TEXT("ItemPickupActor: Overlap with non-player actor: %s"), 
-		       OtherActor ? *OtherActor->GetName() : TEXT("NULL"));
-	}
-}
-
 bool AItemPickupActor::CanPickup(AActionRPGPlayerCharacter* Player) const
 {
 	UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::CanPickup - Starting validation"));
@@ -129,6 +120,12 @@ bool AItemPickupActor::CanPickup(AActionRPGPlayerCharacter* Player) const
 		return false;
 	}
 
+	if (!IsLootableBy(Player))
+	{
+		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::CanPickup - Loot belongs to another player"));
+		return false;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::CanPickup - ItemData: %s, Quantity: %d"), 
 	       *ItemData->ItemName.ToString(), Quantity);
 
@@ -145,12 +142,12 @@ bool AItemPickupActor::CanPickup(AActionRPGPlayerCharacter* Player) const
 	       InventoryComponent->GetTotalItemCount(), InventoryComponent->GetMaxCapacity());
 
 		// Create temporary item to check if inventory has space
-		if (UItemDatabase* ItemDB = UItemDatabase::Get())
+		if (UItemDatabase* ItemDB = UItemDatabase::Get(this))
 		{
 			UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::CanPickup - ItemDatabase found, creating temp item..."));
 			
 			// Create temp item with quantity 1 for template (HasSpaceFor now takes quantity parameter)
-			if (UItemBase* TempItem = ItemDB->CreateItem(ItemData->ItemID, 1))
+			if (UItemBase* TempItem = ItemDB->CreateItem(ItemData->ItemID, 1, this))
 			{
 				UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::CanPickup - Temp item created: %s (Template Quantity: 1, Pickup Quantity: %d)"),
 				       TempItem->ItemData ? *TempItem->ItemData->ItemName.ToString() : TEXT("NULL ItemData"),
@@ -162,8 +159,11 @@ bool AItemPickupActor::CanPickup(AActionRPGPlayerCharacter* Player) const
 				UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::CanPickup - HasSpaceFor returned: %s"), 
 				       bHasSpace ? TEXT("TRUE") : TEXT("FALSE"));
 				
-				// Clean up temporary item - let GC handle it since it's not referenced
-				// In UE 5.7, objects without references will be garbage collected automatically
+				// Return temporary item to the pool (falls back to GC when there is no pool)
+				if (UItemInstancePool* Pool = UItemInstancePool::Get(this))
+				{
+					Pool->Release(TempItem);
+				}
 				
 				if (!bHasSpace)
 				{
@@ -199,6 +199,13 @@ void AItemPickupActor::PickupItem(AActionRPGPlayerCharacter* Player)
 		return;
 	}
 
+	// Clients go through AActionRPGPlayerController::ServerInteractWithPickup
+	if (!HasAuthority())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ItemPickupActor::PickupItem - Called without authority on %s"), *GetName());
+		return;
+	}
+
 	UInventoryComponent* InventoryComponent = Player->InventoryComponent;
 	if (!InventoryComponent)
 	{
@@ -211,12 +218,12 @@ void AItemPickupActor::PickupItem(AActionRPGPlayerCharacter* Player)
 
 	// Create item instance from ItemDataAsset using ItemDatabase
 	// The item is used as a template - AddItem will create new instances as needed
-	if (UItemDatabase* ItemDB = UItemDatabase::Get())
+	if (UItemDatabase* ItemDB = UItemDatabase::Get(this))
 	{
 		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::PickupItem - ItemDatabase found"));
 		
 		// Create item template with quantity 1 (AddItem uses the Quantity parameter)
-		if (UItemBase* Item = ItemDB->CreateItem(ItemData->ItemID, 1))
+		if (UItemBase* Item = ItemDB->CreateItem(ItemData->ItemID, 1, this))
 		{
 			UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::PickupItem - Item template created successfully: %s (Template Quantity: 1, Pickup Quantity: %d)"),
 			       Item->ItemData ? *Item->ItemData->ItemName.ToString() : TEXT("NULL ItemData"),
@@ -227,6 +234,12 @@ void AItemPickupActor::PickupItem(AActionRPGPlayerCharacter* Player)
 			UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::PickupItem - Calling AddItem with Quantity: %d..."), Quantity);
 			
 			bool bAddSuccess = InventoryComponent->AddItem(Item, Quantity);
+
+			// AddItem copies from the template, so it can go straight back to the pool
+			if (UItemInstancePool* Pool = UItemInstancePool::Get(this))
+			{
+				Pool->Release(Item);
+			}
 			
 			UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::PickupItem - AddItem returned: %s"),
 			       bAddSuccess ? TEXT("TRUE") : TEXT("FALSE"));
@@ -236,22 +249,13 @@ void AItemPickupActor::PickupItem(AActionRPGPlayerCharacter* Player)
 				UE_LOG(LogTemp, Log, TEXT("ItemPickupActor: Item picked up successfully - %s (Quantity: %d)"), 
 				       *ItemData->ItemName.ToString(), Quantity);
 
-				// Spawn pickup effect
-				SpawnPickupEffect();
-
-				// Template item will be garbage collected automatically since it's not stored
-				// AddItem creates its own instances that are properly referenced by TObjectPtr
-
-				// Destroy pickup
 				UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::PickupItem - Destroying pickup actor..."));
-				DestroyPickup();
+				CompletePickup();
 			}
 			else
 			{
 				UE_LOG(LogTemp, Error, TEXT("ItemPickupActor: Failed to add item to inventory - %s (Quantity: %d)"), 
 				       *ItemData->ItemName.ToString(), Quantity);
-				
-				// Item will be garbage collected automatically since it's not referenced
 			}
 		}
 		else
@@ -266,6 +270,29 @@ void AItemPickupActor::PickupItem(AActionRPGPlayerCharacter* Player)
 	}
 }
 
+bool AItemPickupActor::IsLootableBy(const AActionRPGPlayerCharacter* Player) const
+{
+	if (!Player)
+	{
+		return false;
+	}
+
+	if (IsPersonalLoot() && Player != GetOwner() && Player->GetOwner() != GetOwner())
+	{
+		return false;
+	}
+
+	// Dropped loot belongs to its owner until the ownership window ends
+	const ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this);
+	return !LootLifetime || LootLifetime->CanLoot(LootHandle, Player);
+}
+
+void AItemPickupActor::CompletePickup()
+{
+	SpawnPickupEffect();
+	DestroyPickup();
+}
+
 void AItemPickupActor::SpawnPickupEffect()
 {
 	// Log pickup for debugging
@@ -276,12 +303,105 @@ void AItemPickupActor::SpawnPickupEffect()
 	// For now, just log the pickup
 }
 
+void AItemPickupActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this))
+	{
+		WorldItems->UnregisterPickup(this);
+	}
+
+	if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
+	{
+		LootLifetime->UntrackLoot(LootHandle);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AItemPickupActor::DestroyPickup()
 {
+	// A client only holds a replicated proxy; the server removes the pickup
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	// Return to the pool for the next drop rather than destroying
+	if (UPickupActorPool* Pool = UPickupActorPool::Get(this))
+	{
+		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor: Releasing pickup to pool - %s"), *GetName());
+		Pool->ReleasePickup(this);
+		return;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("ItemPickupActor: Destroying pickup - %s"), *GetName());
 	Destroy();
 }
 
+void AItemPickupActor::ActivatePickup(const FVector& Location)
+{
+	if (!bInPickupPool)
+	{
+		return;
+	}
+
+	bInPickupPool = false;
+	SetActorLocationAndRotation(Location, FRotator::ZeroRotator, false, nullptr, ETeleportType::TeleportPhysics);
+	SetActorHiddenInGame(false);
+	WakeForReplication();
+
+	if (UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this))
+	{
+		WorldItems->RegisterPickup(this);
+	}
+}
+
+void AItemPickupActor::DeactivatePickup()
+{
+	if (bInPickupPool)
+	{
+		return;
+	}
+
+	bInPickupPool = true;
+	if (UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this))
+	{
+		WorldItems->UnregisterPickup(this);
+	}
+
+	if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
+	{
+		LootLifetime->UntrackLoot(LootHandle);
+	}
+
+	SetActorHiddenInGame(true);
+	ItemData = nullptr;
+	Quantity = 1;
+
+	// Also wakes the pickup so clients drop it
+	SetPersonalLoot(nullptr);
+}
+
+void AItemPickupActor::SetPersonalLoot(AActor* LootOwner)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	SetOwner(LootOwner);
+	bOnlyRelevantToOwner = LootOwner != nullptr;
+	WakeForReplication();
+}
+
+void AItemPickupActor::WakeForReplication()
+{
+	if (HasAuthority() && GetIsReplicated())
+	{
+		FlushNetDormancy();
+	}
+}
+
 void AItemPickupActor::SetupVisuals()
 {
 	if (!MeshComponent)
@@ -342,6 +462,12 @@ bool AItemPickupActor::TryInteract(AActionRPGPlayerCharacter* Player)
 		return false;
 	}
 
+	if (!HasAuthority())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("ItemPickupActor::TryInteract - Pickup is server-owned"));
+		return false;
+	}
+
 	// Check if player is in range
 	if (!IsPlayerInRange(Player))
 	{
@@ -392,9 +518,16 @@ void AItemPickupActor::SetItemData(UItemDataAsset* NewItemData)
 	UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::SetItemData - Called with NewItemData: %s (Pointer: %p)"), 
 		NewItemData ? *NewItemData->ItemName.ToString() : TEXT("NULL"), NewItemData);
 	
+	if (!HasAuthority())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ItemPickupActor::SetItemData - Called without authority on %s"), *GetName());
+		return;
+	}
+
 	if (NewItemData)
 	{
 		ItemData = NewItemData;
+		WakeForReplication();
 		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::SetItemData - ItemData member set to: %s (Pointer: %p)"), 
 			ItemData ? *ItemData->ItemName.ToString() : TEXT("NULL"), ItemData.Get());
 		
@@ -419,9 +552,16 @@ void AItemPickupActor::SetItemData(UItemDataAsset* NewItemData)
 
 void AItemPickupActor::SetQuantity(int32 NewQuantity)
 {
+	if (!HasAuthority())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ItemPickupActor::SetQuantity - Called without authority on %s"), *GetName());
+		return;
+	}
+
 	if (NewQuantity > 0)
 	{
 		Quantity = NewQuantity;
+		WakeForReplication();
 		UE_LOG(LogTemp, Log, TEXT("ItemPickupActor::SetQuantity - Quantity set: %d"), Quantity);
 	}
 	else
@@ -0,0 +1,380 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Items/Pickups/LootLifetimeSubsystem.h"
+#include "Items/Pickups/ItemPickupActor.h"
+#include "Items/Pickups/WorldItemSubsystem.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Loot Lifetime Tick"), STAT_LootLifetimeTick, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tracked Loot"), STAT_TrackedLoot, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Loot Expired"), STAT_LootExpired, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Loot Evicted"), STAT_LootEvicted, STATGROUP_ActionRPG);
+
+ULootLifetimeSubsystem* ULootLifetimeSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<ULootLifetimeSubsystem>() : nullptr;
+}
+
+bool ULootLifetimeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void ULootLifetimeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TimerWheel = FHierarchicalTimerWheel(TimerTickInterval);
+
+	for (int32 Rarity = 0; Rarity < NumRarities; Rarity++)
+	{
+		RarityHeads[Rarity] = INDEX_NONE;
+		RarityTails[Rarity] = INDEX_NONE;
+		Lifetimes[Rarity] = DefaultLifetime;
+		OwnershipWindows[Rarity] = DefaultOwnershipWindow;
+	}
+
+	for (const FLootRarityRule& Rule : RarityRules)
+	{
+		const int32 Rarity = static_cast<int32>(Rule.Rarity);
+		if (Rarity < NumRarities)
+		{
+			Lifetimes[Rarity] = Rule.Lifetime;
+			OwnershipWindows[Rarity] = Rule.OwnershipWindow;
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("LootLifetimeSubsystem: Initialized (Cap: %d, Rarity rules: %d)"), MaxTrackedLoot, RarityRules.Num());
+}
+
+void ULootLifetimeSubsystem::Deinitialize()
+{
+	TimerWheel.Reset();
+	Records.Empty();
+	FreeRecords.Empty();
+	NumTrackedLoot = 0;
+	for (int32 Rarity = 0; Rarity < NumRarities; Rarity++)
+	{
+		RarityHeads[Rarity] = INDEX_NONE;
+		RarityTails[Rarity] = INDEX_NONE;
+	}
+	SET_DWORD_STAT(STAT_TrackedLoot, 0);
+
+	Super::Deinitialize();
+}
+
+void ULootLifetimeSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_LootLifetimeTick);
+
+	// Only loot expiring this frame is touched
+	TimerWheel.Advance(DeltaTime, [this](uint64 Payload)
+	{
+		HandleExpiryTimer(Payload);
+	});
+}
+
+TStatId ULootLifetimeSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULootLifetimeSubsystem, STATGROUP_Tickables);
+}
+
+void ULootLifetimeSubsystem::TrackPickup(AItemPickupActor& Pickup, AActor* LootOwner)
+{
+	// Loot timers run on the server, which owns the pickups
+	if (!Pickup.HasAuthority())
+	{
+		return;
+	}
+
+	UntrackLoot(Pickup.LootHandle);
+
+	const UItemDataAsset* ItemData = Pickup.GetItemData();
+	const EItemRarity Rarity = ItemData ? ItemData->Rarity : EItemRarity::Common;
+
+	const FLootHandle Handle = AddRecord(Rarity, LootOwner);
+	Records[Handle.Index].Pickup = &Pickup;
+	Pickup.LootHandle = Handle;
+}
+
+FLootHandle ULootLifetimeSubsystem::TrackWorldItem(int32 EntryId, EItemRarity Rarity, AActor* LootOwner)
+{
+	const FLootHandle Handle = AddRecord(Rarity, LootOwner);
+	Records[Handle.Index].WorldItemId = EntryId;
+	return Handle;
+}
+
+void ULootLifetimeSubsystem::TransferToPickup(FLootHandle& Handle, AItemPickupActor& Pickup)
+{
+	if (!IsRecordCurrent(Handle))
+	{
+		Handle.Reset();
+		return;
+	}
+
+	UntrackLoot(Pickup.LootHandle);
+
+	FLootRecord& Record = Records[Handle.Index];
+	Record.Pickup = &Pickup;
+	Record.WorldItemId = INDEX_NONE;
+	Pickup.LootHandle = Handle;
+	Handle.Reset();
+}
+
+FLootHandle ULootLifetimeSubsystem::TransferToWorldItem(AItemPickupActor& Pickup, int32 EntryId)
+{
+	FLootHandle Handle = Pickup.LootHandle;
+	Pickup.LootHandle.Reset();
+	if (!IsRecordCurrent(Handle))
+	{
+		return FLootHandle();
+	}
+
+	FLootRecord& Record = Records[Handle.Index];
+	Record.Pickup = nullptr;
+	Record.WorldItemId = EntryId;
+	return Handle;
+}
+
+void ULootLifetimeSubsystem::UntrackLoot(FLootHandle& Handle)
+{
+	if (IsRecordCurrent(Handle))
+	{
+		RemoveRecord(Handle.Index);
+	}
+	Handle.Reset();
+}
+
+bool ULootLifetimeSubsystem::CanLoot(const FLootHandle& Handle, const AActor* Looter) const
+{
+	if (!IsRecordCurrent(Handle))
+	{
+		return true;
+	}
+
+	const FLootRecord& Record = Records[Handle.Index];
+	const AActor* LootOwner = Record.LootOwner.Get();
+	if (!LootOwner || GetWorldTime() >= Record.OwnershipEndTime)
+	{
+		return true;
+	}
+
+	return Looter && (Looter == LootOwner || Looter->GetOwner() == LootOwner);
+}
+
+float ULootLifetimeSubsystem::GetTimeRemaining(const FLootHandle& Handle) const
+{
+	return IsRecordCurrent(Handle) ? static_cast<float>(TimerWheel.GetTimeRemaining(Records[Handle.Index].ExpiryTimer)) : 0.0f;
+}
+
+bool ULootLifetimeSubsystem::CanMergeLoot(const FLootHandle& Handle, const AActor* LootOwner) const
+{
+	// Untracked loot has no owner and never expires; only ownerless drops may join it
+	if (!IsRecordCurrent(Handle))
+	{
+		return LootOwner == nullptr;
+	}
+
+	return Records[Handle.Index].LootOwner.Get() == LootOwner && CanLoot(Handle, LootOwner);
+}
+
+void ULootLifetimeSubsystem::RefreshMergedLoot(const FLootHandle& Handle, EItemRarity Rarity)
+{
+	if (!IsRecordCurrent(Handle))
+	{
+		return;
+	}
+
+	const int32 RarityIndex = FMath::Clamp(static_cast<int32>(Rarity), 0, NumRarities - 1);
+	FLootRecord& Record = Records[Handle.Index];
+	Record.OwnershipEndTime = FMath::Max(Record.OwnershipEndTime, GetWorldTime() + OwnershipWindows[RarityIndex]);
+
+	// A topped-up pile is as fresh as the drop it absorbed - the cap evicts it last
+	UnlinkRarity(Handle.Index);
+	LinkRarityTail(Handle.Index);
+
+	// No timer means the loot already never expires
+	if (!Record.ExpiryTimer.IsSet())
+	{
+		return;
+	}
+
+	const float Lifetime = Lifetimes[RarityIndex];
+	if (Lifetime <= 0.0f)
+	{
+		TimerWheel.Cancel(Record.ExpiryTimer);
+		Record.ExpiryTimer.Reset();
+	}
+	else if (TimerWheel.GetTimeRemaining(Record.ExpiryTimer) < Lifetime)
+	{
+		TimerWheel.Cancel(Record.ExpiryTimer);
+		Record.ExpiryTimer = TimerWheel.Schedule(Lifetime, MakePayload(Handle.Index, Record.Generation));
+	}
+}
+
+void ULootLifetimeSubsystem::MakeRoomForLoot()
+{
+	while (NumTrackedLoot >= MaxTrackedLoot && EvictOldestLoot())
+	{
+	}
+}
+
+FLootHandle ULootLifetimeSubsystem::AddRecord(EItemRarity Rarity, AActor* LootOwner)
+{
+	MakeRoomForLoot();
+
+	const int32 RecordIndex = FreeRecords.Num() > 0 ? FreeRecords.Pop(EAllowShrinking::No) : Records.AddDefaulted();
+	const int32 RarityIndex = FMath::Clamp(static_cast<int32>(Rarity), 0, NumRarities - 1);
+
+	FLootRecord& Record = Records[RecordIndex];
+	Record.LootOwner = LootOwner;
+	Record.OwnershipEndTime = GetWorldTime() + OwnershipWindows[RarityIndex];
+	Record.Rarity = RarityIndex;
+	Record.bInUse = true;
+
+	if (Lifetimes[RarityIndex] > 0.0f)
+	{
+		Record.ExpiryTimer = TimerWheel.Schedule(Lifetimes[RarityIndex], MakePayload(RecordIndex, Record.Generation));
+	}
+
+	LinkRarityTail(RecordIndex);
+
+	NumTrackedLoot++;
+	SET_DWORD_STAT(STAT_TrackedLoot, NumTrackedLoot);
+
+	FLootHandle Handle;
+	Handle.Index = RecordIndex;
+	Handle.Generation = Record.Generation;
+	return Handle;
+}
+
+void ULootLifetimeSubsystem::RemoveRecord(int32 RecordIndex)
+{
+	FLootRecord& Record = Records[RecordIndex];
+	TimerWheel.Cancel(Record.ExpiryTimer);
+	UnlinkRarity(RecordIndex);
+
+	// Bumping the generation invalidates every outstanding handle and timer payload
+	const uint32 NextGeneration = Record.Generation + 1;
+	Record = FLootRecord();
+	Record.Generation = NextGeneration;
+	FreeRecords.Add(RecordIndex);
+
+	NumTrackedLoot--;
+	SET_DWORD_STAT(STAT_TrackedLoot, NumTrackedLoot);
+}
+
+bool ULootLifetimeSubsystem::IsRecordCurrent(const FLootHandle& Handle) const
+{
+	return Records.IsValidIndex(Handle.Index)
+		&& Records[Handle.Index].bInUse
+		&& Records[Handle.Index].Generation == Handle.Generation;
+}
+
+void ULootLifetimeSubsystem::LinkRarityTail(int32 RecordIndex)
+{
+	// Append to its rarity's list - the head is always the oldest
+	FLootRecord& Record = Records[RecordIndex];
+	Record.PrevInRarity = RarityTails[Record.Rarity];
+	Record.NextInRarity = INDEX_NONE;
+	if (RarityTails[Record.Rarity] != INDEX_NONE)
+	{
+		Records[RarityTails[Record.Rarity]].NextInRarity = RecordIndex;
+	}
+	else
+	{
+		RarityHeads[Record.Rarity] = RecordIndex;
+	}
+	RarityTails[Record.Rarity] = RecordIndex;
+}
+
+void ULootLifetimeSubsystem::UnlinkRarity(int32 RecordIndex)
+{
+	FLootRecord& Record = Records[RecordIndex];
+	if (Record.PrevInRarity != INDEX_NONE)
+	{
+		Records[Record.PrevInRarity].NextInRarity = Record.NextInRarity;
+	}
+	else
+	{
+		RarityHeads[Record.Rarity] = Record.NextInRarity;
+	}
+
+	if (Record.NextInRarity != INDEX_NONE)
+	{
+		Records[Record.NextInRarity].PrevInRarity = Record.PrevInRarity;
+	}
+	else
+	{
+		RarityTails[Record.Rarity] = Record.PrevInRarity;
+	}
+	Record.PrevInRarity = INDEX_NONE;
+	Record.NextInRarity = INDEX_NONE;
+}
+
+void ULootLifetimeSubsystem::DespawnLoot(int32 RecordIndex)
+{
+	AItemPickupActor* Pickup = Records[RecordIndex].Pickup.Get();
+	const int32 WorldItemId = Records[RecordIndex].WorldItemId;
+
+	// Freed before the loot goes away, so the removal paths find a stale handle
+	RemoveRecord(RecordIndex);
+
+	if (Pickup)
+	{
+		Pickup->LootHandle.Reset();
+		Pickup->DestroyPickup();
+	}
+	else if (WorldItemId != INDEX_NONE)
+	{
+		if (UWorldItemSubsystem* WorldItems = UWorldItemSubsystem::Get(this))
+		{
+			WorldItems->RemoveWorldItem(WorldItemId);
+		}
+	}
+}
+
+bool ULootLifetimeSubsystem::EvictOldestLoot()
+{
+	for (int32 Rarity = 0; Rarity < NumRarities; Rarity++)
+	{
+		if (RarityHeads[Rarity] != INDEX_NONE)
+		{
+			DespawnLoot(RarityHeads[Rarity]);
+			INC_DWORD_STAT(STAT_LootEvicted);
+			return true;
+		}
+	}
+	return false;
+}
+
+void ULootLifetimeSubsystem::HandleExpiryTimer(uint64 Payload)
+{
+	FLootHandle Handle;
+	Handle.Index = static_cast<int32>(Payload & 0xFFFFFFFF);
+	Handle.Generation = static_cast<uint32>(Payload >> 32);
+
+	if (!IsRecordCurrent(Handle))
+	{
+		return;
+	}
+
+	Records[Handle.Index].ExpiryTimer.Reset();
+	DespawnLoot(Handle.Index);
+	INC_DWORD_STAT(STAT_LootExpired);
+}
+
+double ULootLifetimeSubsystem::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
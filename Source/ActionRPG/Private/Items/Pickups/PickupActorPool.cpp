@@ -0,0 +1,191 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Items/Pickups/PickupActorPool.h"
+#include "Items/Pickups/ItemPickupActor.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Data/ActionRPGDataSubsystem.h"
+#include "Data/ItemDatabase.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pickup Pool Hits"), STAT_PickupPoolHits, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pickup Pool Spawns"), STAT_PickupPoolSpawns, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pickup Pool Free"), STAT_PickupPoolFree, STATGROUP_ActionRPG);
+
+UPickupActorPool* UPickupActorPool::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UPickupActorPool>() : nullptr;
+}
+
+bool UPickupActorPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPickupActorPool::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	Prewarm(AItemPickupActor::StaticClass(), PrewarmCountPerClass);
+
+	// Item pickup classes are known once the item database has loaded
+	if (UActionRPGDataSubsystem* DataSubsystem = UActionRPGDataSubsystem::Get(this))
+	{
+		if (DataSubsystem->IsDataReady())
+		{
+			PrewarmItemClasses();
+		}
+		else
+		{
+			DataSubsystem->OnDataReady.AddUniqueDynamic(this, &UPickupActorPool::PrewarmItemClasses);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("PickupActorPool: Pre-warmed %d pickup actors (Max pooled per class: %d)"), NumFreePickups, MaxPooledPerClass);
+}
+
+void UPickupActorPool::Deinitialize()
+{
+	if (UActionRPGDataSubsystem* DataSubsystem = UActionRPGDataSubsystem::Get(this))
+	{
+		DataSubsystem->OnDataReady.RemoveDynamic(this, &UPickupActorPool::PrewarmItemClasses);
+	}
+
+	// Pooled actors belong to the level and go away with it
+	FreeLists.Empty();
+	NumFreePickups = 0;
+	SET_DWORD_STAT(STAT_PickupPoolFree, 0);
+
+	Super::Deinitialize();
+}
+
+void UPickupActorPool::PrewarmItemClasses()
+{
+	const UItemDatabase* ItemDB = UItemDatabase::Get(this);
+	if (!ItemDB)
+	{
+		return;
+	}
+
+	TSet<UClass*> PickupClasses;
+	for (const UItemDataAsset* ItemData : ItemDB->GetAllItemDataAssets())
+	{
+		if (ItemData && ItemData->ItemPickupActorClass)
+		{
+			PickupClasses.Add(ItemData->ItemPickupActorClass.Get());
+		}
+	}
+
+	for (UClass* PickupClass : PickupClasses)
+	{
+		Prewarm(PickupClass, PrewarmCountPerClass);
+	}
+}
+
+AItemPickupActor* UPickupActorPool::SpawnPickup(UWorld& World, UClass* PickupClass, const FVector& Location, bool bPooled)
+{
+	const FTransform SpawnTransform(Location);
+	AItemPickupActor* Pickup = World.SpawnActorDeferred<AItemPickupActor>(PickupClass, SpawnTransform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!Pickup)
+	{
+		return nullptr;
+	}
+
+	// Pooled pickups begin play hidden and unregistered
+	Pickup->bInPickupPool = bPooled;
+	Pickup->FinishSpawning(SpawnTransform);
+
+	INC_DWORD_STAT(STAT_PickupPoolSpawns);
+	return Pickup;
+}
+
+AItemPickupActor* UPickupActorPool::AcquirePickup(TSubclassOf<AItemPickupActor> PickupClass, FVector Location)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	if (!PickupClass)
+	{
+		PickupClass = AItemPickupActor::StaticClass();
+	}
+
+	if (FPickupActorFreeList* FreeList = FreeLists.Find(PickupClass.Get()))
+	{
+		while (FreeList->FreeActors.Num() > 0)
+		{
+			AItemPickupActor* Pickup = FreeList->FreeActors.Pop(EAllowShrinking::No);
+			NumFreePickups--;
+			SET_DWORD_STAT(STAT_PickupPoolFree, NumFreePickups);
+
+			if (IsValid(Pickup))
+			{
+				Pickup->ActivatePickup(Location);
+				INC_DWORD_STAT(STAT_PickupPoolHits);
+				return Pickup;
+			}
+		}
+	}
+
+	return SpawnPickup(*World, PickupClass.Get(), Location, false);
+}
+
+void UPickupActorPool::ReleasePickup(AItemPickupActor* Pickup)
+{
+	if (!IsValid(Pickup) || Pickup->IsInPickupPool() || !Pickup->HasAuthority())
+	{
+		return;
+	}
+
+	FPickupActorFreeList& FreeList = FreeLists.FindOrAdd(Pickup->GetClass());
+	if (FreeList.FreeActors.Num() >= MaxPooledPerClass)
+	{
+		Pickup->Destroy();
+		return;
+	}
+
+	Pickup->DeactivatePickup();
+	FreeList.FreeActors.Add(Pickup);
+	NumFreePickups++;
+	SET_DWORD_STAT(STAT_PickupPoolFree, NumFreePickups);
+}
+
+void UPickupActorPool::Prewarm(TSubclassOf<AItemPickupActor> PickupClass, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!World || !PickupClass || World->GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	FPickupActorFreeList& FreeList = FreeLists.FindOrAdd(PickupClass.Get());
+	const int32 Target = FMath::Min(Count, MaxPooledPerClass);
+	while (FreeList.FreeActors.Num() < Target)
+	{
+		AItemPickupActor* Pickup = SpawnPickup(*World, PickupClass.Get(), FVector::ZeroVector, true);
+		if (!Pickup)
+		{
+			break;
+		}
+
+		FreeList.FreeActors.Add(Pickup);
+		NumFreePickups++;
+	}
+
+	SET_DWORD_STAT(STAT_PickupPoolFree, NumFreePickups);
+}
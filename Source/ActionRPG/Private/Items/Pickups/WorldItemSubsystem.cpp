@@ -0,0 +1,724 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Items/Pickups/WorldItemSubsystem.h"
+#include "Items/Pickups/ItemPickupActor.h"
+#include "Items/Pickups/PickupActorPool.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Data/ItemDatabase.h"
+#include "Characters/ActionRPGPlayerCharacter.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("World Item Query"), STAT_WorldItemQuery, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("World Item Auto Pickup"), STAT_WorldItemAutoPickup, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("World Items"), STAT_WorldItems, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Stored World Items"), STAT_StoredWorldItems, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("World Item Materializations"), STAT_WorldItemMaterializations, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Auto-Picked Up Items"), STAT_AutoPickupItems, STATGROUP_ActionRPG);
+
+UWorldItemSubsystem* UWorldItemSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UWorldItemSubsystem>() : nullptr;
+}
+
+bool UWorldItemSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWorldItemSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Grid.SetCellSize(CellSize);
+	ItemGrid.SetCellSize(CellSize);
+
+	UE_LOG(LogTemp, Log, TEXT("WorldItemSubsystem: Initialized (Cell size: %.0f, Auto-pickup interval: %.2fs)"), CellSize, AutoPickupInterval);
+}
+
+void UWorldItemSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<AItemPickupActor>, FRegistration>& Pair : Registrations)
+	{
+		if (USceneComponent* RootComponent = Pair.Value.RootComponent.Get())
+		{
+			RootComponent->TransformUpdated.Remove(Pair.Value.TransformUpdatedHandle);
+		}
+	}
+
+	Registrations.Empty();
+	Grid.Reset();
+	PickupsInRange.Empty();
+	QueryResults.Empty();
+	MaxInteractionRange = 0.0f;
+	MaxNetCullDistance = 0.0f;
+	NumAutoPickups = 0;
+	SET_DWORD_STAT(STAT_WorldItems, 0);
+
+	// Renderer components go away with the world
+	WorldItems.Empty();
+	FreeWorldItems.Empty();
+	ItemGrid.Reset();
+	WorldItemQueryResults.Empty();
+	BatchComponents.Empty();
+	BatchInstanceEntries.Empty();
+	BatchLookup.Empty();
+	WorldItemRenderer = nullptr;
+	MaxWorldItemInteractionRange = 0.0f;
+	NumAutoPickupWorldItems = 0;
+	SET_DWORD_STAT(STAT_StoredWorldItems, 0);
+
+	Super::Deinitialize();
+}
+
+TStatId UWorldItemSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWorldItemSubsystem, STATGROUP_Tickables);
+}
+
+void UWorldItemSubsystem::RegisterPickup(AItemPickupActor* Pickup)
+{
+	if (!Pickup || Registrations.Contains(Pickup))
+	{
+		return;
+	}
+
+	USceneComponent* RootComponent = Pickup->GetRootComponent();
+	if (!RootComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("WorldItemSubsystem::RegisterPickup - %s has no root component"), *Pickup->GetName());
+		return;
+	}
+
+	FRegistration& Registration = Registrations.Add(Pickup);
+	Registration.GridId = Grid.Add(Pickup, RootComponent->GetComponentLocation());
+	Registration.bAutoPickup = Pickup->IsAutoPickupEnabled();
+	Registration.RootComponent = RootComponent;
+	Registration.TransformUpdatedHandle = RootComponent->TransformUpdated.AddUObject(
+		this, &UWorldItemSubsystem::HandleTransformUpdated, Registration.GridId);
+
+	MaxInteractionRange = FMath::Max(MaxInteractionRange, Pickup->GetInteractionRange());
+	MaxNetCullDistance = FMath::Max(MaxNetCullDistance, FMath::Sqrt(Pickup->GetNetCullDistanceSquared()));
+	NumAutoPickups += Registration.bAutoPickup ? 1 : 0;
+
+	SET_DWORD_STAT(STAT_WorldItems, Grid.Num());
+}
+
+void UWorldItemSubsystem::UnregisterPickup(AItemPickupActor* Pickup)
+{
+	FRegistration Registration;
+	if (!Registrations.RemoveAndCopyValue(Pickup, Registration))
+	{
+		return;
+	}
+
+	if (USceneComponent* RootComponent = Registration.RootComponent.Get())
+	{
+		RootComponent->TransformUpdated.Remove(Registration.TransformUpdatedHandle);
+	}
+
+	Grid.Remove(Registration.GridId);
+	NumAutoPickups -= Registration.bAutoPickup ? 1 : 0;
+
+	// Pooled actors come back as new drops - one must not look like it was already in range
+	for (TPair<TObjectKey<AActionRPGPlayerCharacter>, FAutoPickupsInRange>& Pair : PickupsInRange)
+	{
+		Pair.Value.Pickups.RemoveSingleSwap(Pickup, EAllowShrinking::No);
+	}
+
+	SET_DWORD_STAT(STAT_WorldItems, Grid.Num());
+}
+
+void UWorldItemSubsystem::HandleTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 GridId)
+{
+	Grid.Update(GridId, UpdatedComponent->GetComponentLocation());
+}
+
+int32 UWorldItemSubsystem::QueryPickupsInRadius(const FVector& Center, float Radius, TArrayView<AItemPickupActor*> OutPickups) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_WorldItemQuery);
+
+	return Grid.QueryRadius(Center, Radius, OutPickups, [](const AItemPickupActor*)
+	{
+		return true;
+	});
+}
+
+AItemPickupActor* UWorldItemSubsystem::FindClosestPickup(const FVector& Location, float Radius) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_WorldItemQuery);
+
+	AItemPickupActor* ClosestPickup = nullptr;
+	double ClosestDistanceSq = FMath::Square(static_cast<double>(Radius));
+	const FVector2D Location2D(Location);
+
+	Grid.ForEachInBox(Location2D - FVector2D(Radius), Location2D + FVector2D(Radius),
+		[&](AItemPickupActor* Pickup, const FVector& PickupLocation)
+		{
+			const double DistanceSq = FVector2D::DistSquared(Location2D, FVector2D(PickupLocation));
+			if (DistanceSq <= ClosestDistanceSq)
+			{
+				ClosestDistanceSq = DistanceSq;
+				ClosestPickup = Pickup;
+			}
+			return true;
+		});
+
+	return ClosestPickup;
+}
+
+int32 UWorldItemSubsystem::GetNumRelevantPickups(const APlayerController* Connection) const
+{
+	if (!Connection || Grid.Num() == 0)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_WorldItemQuery);
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	Connection->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	const AActor* ViewTarget = Connection->GetViewTarget();
+
+	// Only pickups within the largest cull distance can be relevant; each one applies its own
+	const FVector2D View2D(ViewLocation);
+	int32 NumRelevant = 0;
+	Grid.ForEachInBox(View2D - FVector2D(MaxNetCullDistance), View2D + FVector2D(MaxNetCullDistance),
+		[&](const AItemPickupActor* Pickup, const FVector&)
+		{
+			NumRelevant += Pickup->IsNetRelevantFor(Connection, ViewTarget, ViewLocation) ? 1 : 0;
+			return true;
+		});
+
+	return NumRelevant;
+}
+
+void UWorldItemSubsystem::FindPickupsInRadius(FVector Center, float Radius, TArray<AItemPickupActor*>& OutPickups, int32 MaxResults) const
+{
+	OutPickups.SetNumUninitialized(FMath::Max(MaxResults, 0));
+	OutPickups.SetNum(QueryPickupsInRadius(Center, Radius, OutPickups));
+}
+
+void UWorldItemSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (NumAutoPickups == 0 && NumAutoPickupWorldItems == 0)
+	{
+		PickupsInRange.Reset();
+		return;
+	}
+
+	// Poll at a fixed cadence rather than every frame
+	TimeUntilAutoPickup -= DeltaTime;
+	if (TimeUntilAutoPickup > 0.0f)
+	{
+		return;
+	}
+	TimeUntilAutoPickup = FMath::Max(TimeUntilAutoPickup + AutoPickupInterval, 0.0f);
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_WorldItemAutoPickup);
+
+	// Forget players that left
+	for (auto It = PickupsInRange.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		AActionRPGPlayerCharacter* Player = PlayerController ? Cast<AActionRPGPlayerCharacter>(PlayerController->GetPawn()) : nullptr;
+
+		// Inventory changes are made with authority
+		if (Player && Player->HasAuthority())
+		{
+			UpdateAutoPickup(*Player);
+		}
+	}
+}
+
+void UWorldItemSubsystem::UpdateAutoPickup(AActionRPGPlayerCharacter& Player)
+{
+	UInventoryComponent* Inventory = Player.InventoryComponent;
+	if (!Inventory)
+	{
+		return;
+	}
+
+	const FVector PlayerLocation = Player.GetActorLocation();
+	FAutoPickupsInRange& InRange = PickupsInRange.FindOrAdd(&Player);
+	TArray<TObjectKey<AItemPickupActor>, TInlineAllocator<16>> PickupsNowInRange;
+	TArray<int32, TInlineAllocator<16>> WorldItemsNowInRange;
+
+	// Gather - only on entering range, so loot the inventory couldn't take waits for the player to come back.
+	// Each request is backed by either a pickup actor or a stored item.
+	TArray<FInventoryAddRequest, TInlineAllocator<16>> Requests;
+	TArray<AItemPickupActor*, TInlineAllocator<16>> RequestPickups;
+	TArray<int32, TInlineAllocator<16>> RequestWorldItems;
+
+	if (NumAutoPickups > 0)
+	{
+		QueryResults.SetNumUninitialized(MaxQueryResults, EAllowShrinking::No);
+		const int32 NumFound = QueryPickupsInRadius(PlayerLocation, MaxInteractionRange, QueryResults);
+
+		for (int32 Index = 0; Index < NumFound; Index++)
+		{
+			AItemPickupActor* Pickup = QueryResults[Index];
+			if (!Pickup->IsAutoPickupEnabled() || !Pickup->IsPlayerInRange(&Player))
+			{
+				continue;
+			}
+
+			PickupsNowInRange.Add(Pickup);
+			if (InRange.Pickups.Contains(Pickup) || !Pickup->GetItemData() || !Pickup->IsLootableBy(&Player))
+			{
+				continue;
+			}
+
+			FInventoryAddRequest& Request = Requests.AddDefaulted_GetRef();
+			Request.ItemData = Pickup->GetItemData();
+			Request.Quantity = Pickup->GetQuantity();
+			RequestPickups.Add(Pickup);
+			RequestWorldItems.Add(INDEX_NONE);
+		}
+	}
+
+	if (NumAutoPickupWorldItems > 0)
+	{
+		const UItemDatabase* ItemDB = UItemDatabase::Get(this);
+		const ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this);
+
+		WorldItemQueryResults.SetNumUninitialized(MaxQueryResults, EAllowShrinking::No);
+		const int32 NumItemsFound = ItemGrid.QueryRadius(PlayerLocation, MaxWorldItemInteractionRange, WorldItemQueryResults,
+			[this](const int32 EntryId)
+			{
+				return WorldItems[EntryId].bAutoPickup;
+			});
+
+		for (int32 Index = 0; Index < NumItemsFound; Index++)
+		{
+			const int32 EntryId = WorldItemQueryResults[Index];
+			const FWorldItemEntry& Entry = WorldItems[EntryId];
+			if (FVector::Dist(PlayerLocation, Entry.Transform.GetLocation()) > Entry.InteractionRange)
+			{
+				continue;
+			}
+
+			WorldItemsNowInRange.Add(EntryId);
+			if (InRange.WorldItems.Contains(EntryId))
+			{
+				continue;
+			}
+
+			// Someone else's loot stays stored until its ownership window ends
+			UItemDataAsset* ItemData = ItemDB ? ItemDB->GetItemDataAssetByIndex(Entry.ItemIndex) : nullptr;
+			if (!ItemData || (LootLifetime && !LootLifetime->CanLoot(Entry.LootHandle, &Player)))
+			{
+				continue;
+			}
+
+			FInventoryAddRequest& Request = Requests.AddDefaulted_GetRef();
+			Request.ItemData = ItemData;
+			Request.Quantity = Entry.Quantity;
+			RequestPickups.Add(nullptr);
+			RequestWorldItems.Add(EntryId);
+		}
+	}
+
+	// Record what is in range before retiring anything, so retired pickups and stored items are
+	// purged from it (their actors and ids get reused for new drops)
+	InRange.Pickups.Reset();
+	InRange.Pickups.Append(PickupsNowInRange);
+	InRange.WorldItems.Reset();
+	InRange.WorldItems.Append(WorldItemsNowInRange);
+
+	// Commit the sweep as one bulk add, then retire everything that went in
+	if (Requests.Num() > 0)
+	{
+		TArray<bool> Accepted;
+		const int32 NumAccepted = Inventory->AddItemsBulk(Requests, Accepted);
+
+		for (int32 Index = 0; Index < Requests.Num(); Index++)
+		{
+			if (!Accepted[Index])
+			{
+				continue;
+			}
+
+			if (AItemPickupActor* Pickup = RequestPickups[Index])
+			{
+				Pickup->CompletePickup();
+			}
+			else
+			{
+				RemoveWorldItemEntry(RequestWorldItems[Index]);
+			}
+		}
+
+		INC_DWORD_STAT_BY(STAT_AutoPickupItems, NumAccepted);
+	}
+}
+
+int32 UWorldItemSubsystem::FindOrAddMeshBatch(UStaticMesh& Mesh)
+{
+	if (const int32* BatchIndex = BatchLookup.Find(&Mesh))
+	{
+		return *BatchIndex;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return INDEX_NONE;
+	}
+
+	// One holder actor owns every batch component
+	if (!WorldItemRenderer)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		WorldItemRenderer = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!WorldItemRenderer)
+		{
+			return INDEX_NONE;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(WorldItemRenderer, TEXT("Root"));
+		WorldItemRenderer->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(WorldItemRenderer);
+	Component->SetStaticMesh(&Mesh);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetGenerateOverlapEvents(false);
+	Component->SetCanEverAffectNavigation(false);
+	Component->SetupAttachment(WorldItemRenderer->GetRootComponent());
+	Component->RegisterComponent();
+	WorldItemRenderer->AddInstanceComponent(Component);
+
+	const int32 BatchIndex = BatchComponents.Add(Component);
+	BatchInstanceEntries.AddDefaulted();
+	BatchLookup.Add(&Mesh, BatchIndex);
+	return BatchIndex;
+}
+
+bool UWorldItemSubsystem::CanStoreWorldItems() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() == NM_Standalone;
+}
+
+int32 UWorldItemSubsystem::AddWorldItem(UItemDataAsset* ItemData, int32 Quantity, FTransform Transform, AActor* LootOwner)
+{
+	const int32 EntryId = AddWorldItemEntry(ItemData, Quantity, Transform);
+	if (EntryId == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// Tracking may evict older loot, so the entry is looked up again afterwards
+	if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
+	{
+		const FLootHandle LootHandle = LootLifetime->TrackWorldItem(EntryId, ItemData->Rarity, LootOwner);
+		WorldItems[EntryId].LootHandle = LootHandle;
+	}
+
+	return EntryId;
+}
+
+int32 UWorldItemSubsystem::AddWorldItemEntry(UItemDataAsset* ItemData, int32 Quantity, const FTransform& Transform)
+{
+	if (!ItemData || !ItemData->WorldMesh || ItemData->RuntimeIndex == INDEX_NONE || Quantity <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Entries and their instanced meshes are local, so remote players could neither see nor pick them up
+	if (!CanStoreWorldItems())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 BatchIndex = FindOrAddMeshBatch(*ItemData->WorldMesh);
+	if (BatchIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 EntryId = FreeWorldItems.Num() > 0 ? FreeWorldItems.Pop(EAllowShrinking::No) : WorldItems.AddDefaulted();
+
+	// Interaction settings come from the pickup class the item would otherwise spawn
+	const TSubclassOf<AItemPickupActor> PickupClass = ItemData->ItemPickupActorClass ? ItemData->ItemPickupActorClass : TSubclassOf<AItemPickupActor>(AItemPickupActor::StaticClass());
+	const AItemPickupActor* PickupDefaults = PickupClass->GetDefaultObject<AItemPickupActor>();
+
+	FWorldItemEntry& Entry = WorldItems[EntryId];
+	Entry.ItemIndex = ItemData->RuntimeIndex;
+	Entry.Quantity = Quantity;
+	Entry.Transform = Transform;
+	Entry.GridId = ItemGrid.Add(EntryId, Transform.GetLocation());
+	Entry.BatchIndex = BatchIndex;
+	Entry.InstanceIndex = BatchComponents[BatchIndex]->AddInstance(Transform, /*bWorldSpace*/ true);
+	Entry.InteractionRange = PickupDefaults->GetInteractionRange();
+	Entry.bAutoPickup = PickupDefaults->IsAutoPickupEnabled();
+	Entry.bInUse = true;
+
+	BatchInstanceEntries[BatchIndex].Add(EntryId);
+	MaxWorldItemInteractionRange = FMath::Max(MaxWorldItemInteractionRange, Entry.InteractionRange);
+	NumAutoPickupWorldItems += Entry.bAutoPickup ? 1 : 0;
+
+	SET_DWORD_STAT(STAT_StoredWorldItems, ItemGrid.Num());
+	return EntryId;
+}
+
+bool UWorldItemSubsystem::RemoveWorldItem(int32 EntryId)
+{
+	if (!WorldItems.IsValidIndex(EntryId) || !WorldItems[EntryId].bInUse)
+	{
+		return false;
+	}
+
+	RemoveWorldItemEntry(EntryId);
+	return true;
+}
+
+void UWorldItemSubsystem::RemoveWorldItemEntry(int32 EntryId)
+{
+	FWorldItemEntry& Entry = WorldItems[EntryId];
+
+	// Swap-remove the instance: move the batch's last instance into this slot, then drop the last
+	// one, so no other instance index shifts
+	UInstancedStaticMeshComponent* Component = BatchComponents[Entry.BatchIndex];
+	TArray<int32>& InstanceEntries = BatchInstanceEntries[Entry.BatchIndex];
+	const int32 LastInstance = InstanceEntries.Num() - 1;
+	if (Entry.InstanceIndex != LastInstance)
+	{
+		const int32 MovedEntryId = InstanceEntries[LastInstance];
+		FTransform MovedTransform;
+		Component->GetInstanceTransform(LastInstance, MovedTransform, /*bWorldSpace*/ true);
+		Component->UpdateInstanceTransform(Entry.InstanceIndex, MovedTransform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+
+		InstanceEntries[Entry.InstanceIndex] = MovedEntryId;
+		WorldItems[MovedEntryId].InstanceIndex = Entry.InstanceIndex;
+	}
+	Component->RemoveInstance(LastInstance);
+	InstanceEntries.Pop(EAllowShrinking::No);
+
+	ItemGrid.Remove(Entry.GridId);
+	NumAutoPickupWorldItems -= Entry.bAutoPickup ? 1 : 0;
+
+	// The id is recycled - a new item reusing it must not look like it was already in range
+	for (TPair<TObjectKey<AActionRPGPlayerCharacter>, FAutoPickupsInRange>& Pair : PickupsInRange)
+	{
+		Pair.Value.WorldItems.RemoveSingleSwap(EntryId, EAllowShrinking::No);
+	}
+
+	if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
+	{
+		LootLifetime->UntrackLoot(Entry.LootHandle);
+	}
+
+	Entry = FWorldItemEntry();
+	FreeWorldItems.Add(EntryId);
+
+	SET_DWORD_STAT(STAT_StoredWorldItems, ItemGrid.Num());
+}
+
+AItemPickupActor* UWorldItemSubsystem::MaterializeWorldItem(int32 EntryId)
+{
+	if (!WorldItems.IsValidIndex(EntryId) || !WorldItems[EntryId].bInUse)
+	{
+		return nullptr;
+	}
+
+	const FWorldItemEntry Entry = WorldItems[EntryId];
+	const UItemDatabase* ItemDB = UItemDatabase::Get(this);
+	UItemDataAsset* ItemData = ItemDB ? ItemDB->GetItemDataAssetByIndex(Entry.ItemIndex) : nullptr;
+	UWorld* World = GetWorld();
+	if (!ItemData || !World)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("WorldItemSubsystem::MaterializeWorldItem - Item index %d no longer resolves, removing entry"), Entry.ItemIndex);
+		RemoveWorldItemEntry(EntryId);
+		return nullptr;
+	}
+
+	AItemPickupActor* Pickup = nullptr;
+	if (UPickupActorPool* Pool = UPickupActorPool::Get(this))
+	{
+		Pickup = Pool->AcquirePickup(ItemData->ItemPickupActorClass, Entry.Transform.GetLocation());
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		const TSubclassOf<AItemPickupActor> PickupClass = ItemData->ItemPickupActorClass ? ItemData->ItemPickupActorClass : TSubclassOf<AItemPickupActor>(AItemPickupActor::StaticClass());
+		Pickup = World->SpawnActor<AItemPickupActor>(PickupClass, Entry.Transform, SpawnParams);
+	}
+
+	if (!Pickup)
+	{
+		return nullptr;
+	}
+
+	// The pickup keeps the entry's despawn clock and owner
+	if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
+	{
+		LootLifetime->TransferToPickup(WorldItems[EntryId].LootHandle, *Pickup);
+	}
+
+	RemoveWorldItemEntry(EntryId);
+	Pickup->SetActorRotation(Entry.Transform.GetRotation());
+	Pickup->SetItemData(ItemData);
+	Pickup->SetQuantity(Entry.Quantity);
+
+	INC_DWORD_STAT(STAT_WorldItemMaterializations);
+	return Pickup;
+}
+
+int32 UWorldItemSubsystem::DematerializePickup(AItemPickupActor* Pickup)
+{
+	if (!IsValid(Pickup) || Pickup->IsInPickupPool())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 EntryId = AddWorldItemEntry(Pickup->GetItemData(), Pickup->GetQuantity(), Pickup->GetActorTransform());
+	if (EntryId == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// The entry takes over the pickup's despawn clock and owner, so releasing the actor doesn't untrack it
+	if (ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this))
+	{
+		WorldItems[EntryId].LootHandle = LootLifetime->TransferToWorldItem(*Pickup, EntryId);
+	}
+
+	if (UPickupActorPool* Pool = UPickupActorPool::Get(this))
+	{
+		Pool->ReleasePickup(Pickup);
+	}
+	else
+	{
+		Pickup->Destroy();
+	}
+
+	return EntryId;
+}
+
+int32 UWorldItemSubsystem::MergeIntoNearbyPiles(const UItemDataAsset* ItemData, int32 Quantity, const FVector& Location, AActor* LootOwner)
+{
+	if (!ItemData || Quantity <= 0 || MergeRadius <= 0.0f)
+	{
+		return 0;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_WorldItemQuery);
+
+	int32 Remaining = Quantity;
+
+	// Joining another player's pile would hand them the drop
+	ULootLifetimeSubsystem* LootLifetime = ULootLifetimeSubsystem::Get(this);
+
+	// Evict for the remainder's record now, while no pile has absorbed anything - evicting after the
+	// merge could remove the pile that just took part of this drop
+	if (LootLifetime)
+	{
+		LootLifetime->MakeRoomForLoot();
+	}
+
+	// Stored piles first - topping them up costs nothing to render
+	if (ItemData->RuntimeIndex != INDEX_NONE && ItemGrid.Num() > 0)
+	{
+		WorldItemQueryResults.SetNumUninitialized(MaxQueryResults, EAllowShrinking::No);
+		const int32 NumFound = ItemGrid.QueryRadius(Location, MergeRadius, WorldItemQueryResults,
+			[this, ItemData, LootLifetime, LootOwner](const int32 EntryId)
+			{
+				const FWorldItemEntry& Entry = WorldItems[EntryId];
+				return Entry.ItemIndex == ItemData->RuntimeIndex && Entry.Quantity < MaxPileQuantity
+					&& (!LootLifetime || LootLifetime->CanMergeLoot(Entry.LootHandle, LootOwner));
+			});
+
+		for (int32 Index = 0; Index < NumFound && Remaining > 0; Index++)
+		{
+			FWorldItemEntry& Entry = WorldItems[WorldItemQueryResults[Index]];
+			const int32 Added = FMath::Min(Remaining, MaxPileQuantity - Entry.Quantity);
+			Entry.Quantity += Added;
+			Remaining -= Added;
+			if (LootLifetime)
+			{
+				LootLifetime->RefreshMergedLoot(Entry.LootHandle, ItemData->Rarity);
+			}
+		}
+	}
+
+	if (Remaining > 0 && Grid.Num() > 0)
+	{
+		QueryResults.SetNumUninitialized(MaxQueryResults, EAllowShrinking::No);
+		const int32 NumFound = Grid.QueryRadius(Location, MergeRadius, QueryResults,
+			[this, ItemData, LootLifetime, LootOwner](const AItemPickupActor* Pickup)
+			{
+				return Pickup->GetItemData() == ItemData && Pickup->GetQuantity() < MaxPileQuantity
+					&& (!Pickup->IsPersonalLoot() || Pickup->GetOwner() == LootOwner)
+					&& (!LootLifetime || LootLifetime->CanMergeLoot(Pickup->GetLootHandle(), LootOwner));
+			});
+
+		for (int32 Index = 0; Index < NumFound && Remaining > 0; Index++)
+		{
+			AItemPickupActor* Pickup = QueryResults[Index];
+			const int32 Added = FMath::Min(Remaining, MaxPileQuantity - Pickup->GetQuantity());
+			Pickup->SetQuantity(Pickup->GetQuantity() + Added);
+			Remaining -= Added;
+			if (LootLifetime)
+			{
+				LootLifetime->RefreshMergedLoot(Pickup->GetLootHandle(), ItemData->Rarity);
+			}
+		}
+	}
+
+	return Quantity - Remaining;
+}
+
+int32 UWorldItemSubsystem::QueryWorldItemsInRadius(const FVector& Center, float Radius, TArrayView<int32> OutEntries) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_WorldItemQuery);
+
+	return ItemGrid.QueryRadius(Center, Radius, OutEntries, [](const int32)
+	{
+		return true;
+	});
+}
+
+bool UWorldItemSubsystem::GetWorldItemInfo(int32 EntryId, FVector& OutLocation, float& OutInteractionRange) const
+{
+	if (!WorldItems.IsValidIndex(EntryId) || !WorldItems[EntryId].bInUse)
+	{
+		return false;
+	}
+
+	OutLocation = WorldItems[EntryId].Transform.GetLocation();
+	OutInteractionRange = WorldItems[EntryId].InteractionRange;
+	return true;
+}
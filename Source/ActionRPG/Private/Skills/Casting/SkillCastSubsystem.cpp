@@ -0,0 +1,481 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Skills/Casting/SkillCastSubsystem.h"
+#include "Skills/Core/SkillBase.h"
+#include "Skills/Core/SkillDataAsset.h"
+#include "Skills/Core/SkillActivation.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "Data/SkillDatabase.h"
+#include "Core/ActionRPGStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Skill Cast Tick"), STAT_SkillCastTick, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Skill Casts"), STAT_ActiveSkillCasts, STATGROUP_ActionRPG);
+
+USkillCastSubsystem* USkillCastSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<USkillCastSubsystem>() : nullptr;
+}
+
+bool USkillCastSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USkillCastSubsystem::Deinitialize()
+{
+	TimerWheel.Reset();
+	Casts.Empty();
+	FreeCasts.Empty();
+	CastLookup.Empty();
+	SET_DWORD_STAT(STAT_ActiveSkillCasts, 0);
+
+	Super::Deinitialize();
+}
+
+void USkillCastSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SkillCastTick);
+
+	// Only casts whose phase ends this frame are touched
+	TimerWheel.Advance(DeltaTime, [this](uint64 Payload)
+	{
+		HandlePhaseTimerExpired(Payload);
+	});
+
+	SET_DWORD_STAT(STAT_ActiveSkillCasts, CastLookup.Num());
+}
+
+TStatId USkillCastSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USkillCastSubsystem, STATGROUP_Tickables);
+}
+
+int32 USkillCastSubsystem::FindCast(const AActor* Caster) const
+{
+	const int32* CastIndex = CastLookup.Find(FObjectKey(Caster));
+	return CastIndex ? *CastIndex : INDEX_NONE;
+}
+
+int32 USkillCastSubsystem::AllocateCast(AActor* Caster)
+{
+	int32 CastIndex = INDEX_NONE;
+	if (FreeCasts.Num() > 0)
+	{
+		CastIndex = FreeCasts.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		CastIndex = Casts.AddDefaulted();
+	}
+
+	FSkillCast& Cast = Casts[CastIndex];
+	Cast.Caster = Caster;
+	Cast.CasterKey = FObjectKey(Caster);
+	Cast.Phase = ESkillCastPhase::None;
+	Cast.bInUse = true;
+
+	CastLookup.Add(Cast.CasterKey, CastIndex);
+	return CastIndex;
+}
+
+void USkillCastSubsystem::ReleaseCast(int32 CastIndex)
+{
+	FSkillCast& Cast = Casts[CastIndex];
+	TimerWheel.Cancel(Cast.PhaseTimer);
+	CastLookup.Remove(Cast.CasterKey);
+
+	const uint32 NextGeneration = Cast.Generation + 1;
+	Cast = FSkillCast();
+	Cast.Generation = NextGeneration;
+
+	FreeCasts.Add(CastIndex);
+}
+
+bool USkillCastSubsystem::IsCastCurrent(int32 CastIndex, uint32 Generation) const
+{
+	return Casts.IsValidIndex(CastIndex)
+		&& Casts[CastIndex].bInUse
+		&& Casts[CastIndex].Generation == Generation
+		&& Casts[CastIndex].Phase != ESkillCastPhase::None;
+}
+
+const FSkillSpec* USkillCastSubsystem::FindSpec(int32 SkillIndex) const
+{
+	const USkillDatabase* SkillDB = USkillDatabase::Get(this);
+	return SkillDB ? SkillDB->GetSkillSpec(SkillIndex) : nullptr;
+}
+
+USkillDataAsset* USkillCastSubsystem::GetSkillData(int32 SkillIndex) const
+{
+	const FSkillSpec* Spec = FindSpec(SkillIndex);
+	return Spec ? Spec->SkillData : nullptr;
+}
+
+bool USkillCastSubsystem::BeginCast(USkillBase* Skill, AActor* Target)
+{
+	if (!Skill || !Skill->SkillData)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SkillCastSubsystem::BeginCast - Invalid skill"));
+		return false;
+	}
+
+	AActor* Caster = Skill->GetOwningActor();
+	if (!Caster)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SkillCastSubsystem::BeginCast - Skill %s has no owning actor"), *Skill->GetSkillID().ToString());
+		return false;
+	}
+
+	return BeginSkillCast(Caster, Skill->SkillData->RuntimeIndex, Target, Skill);
+}
+
+bool USkillCastSubsystem::BeginSkillCast(AActor* Caster, int32 SkillIndex, AActor* Target, USkillBase* SkillObject)
+{
+	const FSkillSpec* Spec = FindSpec(SkillIndex);
+	if (!Caster || !Spec)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SkillCastSubsystem::BeginSkillCast - Invalid caster or unregistered skill (index %d)"), SkillIndex);
+		return false;
+	}
+
+	int32 CastIndex = FindCast(Caster);
+	if (CastIndex != INDEX_NONE && Casts[CastIndex].Phase != ESkillCastPhase::None)
+	{
+		// Caster is busy - queue the skill to start when the current cast completes
+		FSkillCast& Cast = Casts[CastIndex];
+		Cast.QueuedSkillIndex = SkillIndex;
+		Cast.QueuedSkillObject = SkillObject;
+		Cast.QueuedTarget = Target;
+
+		UE_LOG(LogTemp, Verbose, TEXT("SkillCastSubsystem::BeginSkillCast - %s queued %s"),
+			*Caster->GetName(), *Spec->SkillID.ToString());
+		return true;
+	}
+
+	if (CastIndex == INDEX_NONE)
+	{
+		CastIndex = AllocateCast(Caster);
+	}
+
+	if (!StartSkill(CastIndex, SkillIndex, Target, SkillObject))
+	{
+		if (Casts[CastIndex].bInUse && Casts[CastIndex].Phase == ESkillCastPhase::None)
+		{
+			ReleaseCast(CastIndex);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+bool USkillCastSubsystem::StartSkill(int32 CastIndex, int32 SkillIndex, AActor* Target, USkillBase* SkillObject)
+{
+	const FSkillSpec* Spec = FindSpec(SkillIndex);
+	AActor* Caster = Casts[CastIndex].Caster.Get();
+	if (!Spec || !Caster)
+	{
+		return false;
+	}
+
+	FCooldownHandle CooldownHandle;
+	FCooldownHandle GroupCooldownHandle;
+	USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this);
+	if (Cooldowns)
+	{
+		FSkillActivation::ResolveCooldownHandles(*Spec, *Cooldowns, Caster, CooldownHandle, GroupCooldownHandle);
+	}
+
+	UAttributeComponent* Attributes = UAttributeComponent::FindAttributeComponent(Caster);
+	const bool bOnCooldown = Cooldowns && FSkillActivation::GetCooldownRemaining(*Cooldowns, CooldownHandle, GroupCooldownHandle) > 0.0f;
+
+	// Skill objects may add their own rules on top (CanActivate overrides)
+	if (bOnCooldown || !FSkillActivation::CanAffordCosts(*Spec, Attributes) || (SkillObject && !SkillObject->CanActivate(Target)))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SkillCastSubsystem::StartSkill - Skill %s cannot be activated"), *Spec->SkillID.ToString());
+		return false;
+	}
+
+	// Costs are paid up front, like the cooldown
+	if (!FSkillActivation::CommitCosts(*Spec, Attributes))
+	{
+		return false;
+	}
+
+	FSkillCast& Cast = Casts[CastIndex];
+	Cast.Generation++;
+	Cast.SkillIndex = SkillIndex;
+	Cast.SkillObject = SkillObject;
+	Cast.Target = Target;
+	Cast.bExecuted = false;
+	Cast.CooldownHandle = CooldownHandle;
+	Cast.GroupCooldownHandle = GroupCooldownHandle;
+	Cast.PreviousCooldownExpiry = 0.0;
+	Cast.PreviousGroupCooldownExpiry = 0.0;
+
+	// Commit the cooldown up front so the skill cannot be recast while casting
+	if (Cooldowns)
+	{
+		FSkillActivation::CommitCooldown(*Spec, *Cooldowns, CooldownHandle, GroupCooldownHandle, Cast.PreviousCooldownExpiry, Cast.PreviousGroupCooldownExpiry);
+	}
+
+	const float CastTime = Spec->CastTime;
+	if (CastTime > 0.0f)
+	{
+		EnterPhase(CastIndex, ESkillCastPhase::Casting, CastTime);
+	}
+	else
+	{
+		ExecuteCast(CastIndex);
+	}
+
+	return true;
+}
+
+void USkillCastSubsystem::EnterPhase(int32 CastIndex, ESkillCastPhase Phase, float Duration)
+{
+	FSkillCast& Cast = Casts[CastIndex];
+	TimerWheel.Cancel(Cast.PhaseTimer);
+	Cast.Phase = Phase;
+	Cast.PhaseTimer = TimerWheel.Schedule(Duration, MakePayload(CastIndex, Cast.Generation));
+
+	OnCastPhaseChanged.Broadcast(Cast.Caster.Get(), GetSkillData(Cast.SkillIndex), Phase);
+}
+
+void USkillCastSubsystem::ExecuteCast(int32 CastIndex)
+{
+	FSkillCast& Cast = Casts[CastIndex];
+	const FSkillSpec* Spec = FindSpec(Cast.SkillIndex);
+	AActor* Caster = Cast.Caster.Get();
+
+	if (!Spec || !Caster)
+	{
+		// Caster went away (or skill data was reloaded) mid-cast
+		EndCast(CastIndex, ESkillCastEndReason::Interrupted);
+		return;
+	}
+
+	const uint32 Generation = Cast.Generation;
+	const float ChannelDuration = Spec->ChannelDuration;
+	const float RecoveryTime = Spec->RecoveryTime;
+
+	TimerWheel.Cancel(Cast.PhaseTimer);
+	Cast.bExecuted = true;
+	if (Cast.Phase == ESkillCastPhase::None)
+	{
+		// Instant cast - mark the slot busy so OnSkillActivated listeners see the caster as casting
+		Cast.Phase = ESkillCastPhase::Casting;
+	}
+
+	AActor* Target = Cast.Target.Get();
+	if (USkillBase* SkillObject = Cast.SkillObject.Get())
+	{
+		SkillObject->ExecuteSkill(Target);
+	}
+	else
+	{
+		FSkillActivation::Execute(*Spec, *Caster, Target);
+	}
+
+	if (IsCastCurrent(CastIndex, Generation))
+	{
+		OnSkillExecuted.Broadcast(Caster, Spec->SkillData, Target);
+	}
+
+	// Listeners may have interrupted or replaced the cast
+	if (!IsCastCurrent(CastIndex, Generation))
+	{
+		return;
+	}
+
+	if (ChannelDuration > 0.0f)
+	{
+		EnterPhase(CastIndex, ESkillCastPhase::Channeling, ChannelDuration);
+	}
+	else if (RecoveryTime > 0.0f)
+	{
+		EnterPhase(CastIndex, ESkillCastPhase::Recovery, RecoveryTime);
+	}
+	else
+	{
+		EndCast(CastIndex, ESkillCastEndReason::Completed);
+	}
+}
+
+void USkillCastSubsystem::AdvanceCast(int32 CastIndex)
+{
+	const FSkillCast& Cast = Casts[CastIndex];
+	switch (Cast.Phase)
+	{
+	case ESkillCastPhase::Casting:
+		ExecuteCast(CastIndex);
+		break;
+
+	case ESkillCastPhase::Channeling:
+	{
+		const FSkillSpec* Spec = FindSpec(Cast.SkillIndex);
+		const float RecoveryTime = Spec ? Spec->RecoveryTime : 0.0f;
+		if (RecoveryTime > 0.0f)
+		{
+			EnterPhase(CastIndex, ESkillCastPhase::Recovery, RecoveryTime);
+		}
+		else
+		{
+			EndCast(CastIndex, ESkillCastEndReason::Completed);
+		}
+		break;
+	}
+
+	case ESkillCastPhase::Recovery:
+		EndCast(CastIndex, ESkillCastEndReason::Completed);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void USkillCastSubsystem::EndCast(int32 CastIndex, ESkillCastEndReason Reason)
+{
+	FSkillCast& Cast = Casts[CastIndex];
+	TimerWheel.Cancel(Cast.PhaseTimer);
+
+	USkillDataAsset* SkillData = GetSkillData(Cast.SkillIndex);
+	AActor* Caster = Cast.Caster.Get();
+
+	// Only a completed cast hands over to the queued skill
+	const int32 QueuedSkillIndex = Reason == ESkillCastEndReason::Completed ? Cast.QueuedSkillIndex : INDEX_NONE;
+	USkillBase* QueuedSkillObject = Cast.QueuedSkillObject.Get();
+	AActor* QueuedTarget = Cast.QueuedTarget.Get();
+
+	Cast.Phase = ESkillCastPhase::None;
+	Cast.SkillIndex = INDEX_NONE;
+	Cast.SkillObject.Reset();
+	Cast.Target.Reset();
+	Cast.QueuedSkillIndex = INDEX_NONE;
+	Cast.QueuedSkillObject.Reset();
+	Cast.QueuedTarget.Reset();
+	Cast.bExecuted = false;
+	const uint32 Generation = Cast.Generation;
+
+	UE_LOG(LogTemp, Verbose, TEXT("SkillCastSubsystem::EndCast - %s: %s ended (%s)"),
+		Caster ? *Caster->GetName() : TEXT("(destroyed)"),
+		SkillData ? *SkillData->SkillID.ToString() : TEXT("NULL"),
+		*UEnum::GetValueAsString(Reason));
+
+	OnCastEnded.Broadcast(Caster, SkillData, Reason);
+
+	// A listener may have started a new cast on this caster already
+	if (!Casts[CastIndex].bInUse || Casts[CastIndex].Generation != Generation || Casts[CastIndex].Phase != ESkillCastPhase::None)
+	{
+		return;
+	}
+
+	if (QueuedSkillIndex != INDEX_NONE && Caster && StartSkill(CastIndex, QueuedSkillIndex, QueuedTarget, QueuedSkillObject))
+	{
+		return;
+	}
+
+	if (Casts[CastIndex].bInUse && Casts[CastIndex].Phase == ESkillCastPhase::None)
+	{
+		ReleaseCast(CastIndex);
+	}
+}
+
+void USkillCastSubsystem::HandlePhaseTimerExpired(uint64 Payload)
+{
+	const int32 CastIndex = static_cast<int32>(Payload & 0xFFFFFFFF);
+	const uint32 Generation = static_cast<uint32>(Payload >> 32);
+
+	if (!IsCastCurrent(CastIndex, Generation))
+	{
+		return;
+	}
+
+	Casts[CastIndex].PhaseTimer.Reset();
+	AdvanceCast(CastIndex);
+}
+
+bool USkillCastSubsystem::InterruptCast(AActor* Caster)
+{
+	const int32 CastIndex = FindCast(Caster);
+	if (CastIndex == INDEX_NONE || Casts[CastIndex].Phase == ESkillCastPhase::None)
+	{
+		return false;
+	}
+
+	EndCast(CastIndex, ESkillCastEndReason::Interrupted);
+	return true;
+}
+
+bool USkillCastSubsystem::CancelCast(AActor* Caster)
+{
+	const int32 CastIndex = FindCast(Caster);
+	if (CastIndex == INDEX_NONE || Casts[CastIndex].Phase == ESkillCastPhase::None)
+	{
+		return false;
+	}
+
+	const FSkillCast& Cast = Casts[CastIndex];
+	const FSkillSpec* Spec = FindSpec(Cast.SkillIndex);
+	if (!Cast.bExecuted && Spec)
+	{
+		if (USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this))
+		{
+			FSkillActivation::RestoreCooldown(*Cooldowns, Cast.CooldownHandle, Cast.GroupCooldownHandle, Cast.PreviousCooldownExpiry, Cast.PreviousGroupCooldownExpiry);
+		}
+		FSkillActivation::RefundCosts(*Spec, UAttributeComponent::FindAttributeComponent(Cast.Caster.Get()));
+	}
+
+	EndCast(CastIndex, ESkillCastEndReason::Cancelled);
+	return true;
+}
+
+void USkillCastSubsystem::ClearQueuedSkill(AActor* Caster)
+{
+	const int32 CastIndex = FindCast(Caster);
+	if (CastIndex != INDEX_NONE)
+	{
+		Casts[CastIndex].QueuedSkillIndex = INDEX_NONE;
+		Casts[CastIndex].QueuedSkillObject.Reset();
+		Casts[CastIndex].QueuedTarget.Reset();
+	}
+}
+
+ESkillCastPhase USkillCastSubsystem::GetCastPhase(const AActor* Caster) const
+{
+	const int32 CastIndex = FindCast(Caster);
+	return CastIndex != INDEX_NONE ? Casts[CastIndex].Phase : ESkillCastPhase::None;
+}
+
+USkillDataAsset* USkillCastSubsystem::GetCastingSkillData(const AActor* Caster) const
+{
+	return GetSkillData(GetCastingSkillIndex(Caster));
+}
+
+int32 USkillCastSubsystem::GetCastingSkillIndex(const AActor* Caster) const
+{
+	const int32 CastIndex = FindCast(Caster);
+	return CastIndex != INDEX_NONE ? Casts[CastIndex].SkillIndex : INDEX_NONE;
+}
+
+int32 USkillCastSubsystem::GetQueuedSkillIndex(const AActor* Caster) const
+{
+	const int32 CastIndex = FindCast(Caster);
+	return CastIndex != INDEX_NONE ? Casts[CastIndex].QueuedSkillIndex : INDEX_NONE;
+}
+
+float USkillCastSubsystem::GetPhaseTimeRemaining(const AActor* Caster) const
+{
+	const int32 CastIndex = FindCast(Caster);
+	return CastIndex != INDEX_NONE ? static_cast<float>(TimerWheel.GetTimeRemaining(Casts[CastIndex].PhaseTimer)) : 0.0f;
+}
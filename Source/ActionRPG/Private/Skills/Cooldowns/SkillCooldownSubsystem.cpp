@@ -0,0 +1,264 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
+#include "Skills/Core/SkillDataAsset.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+USkillCooldownSubsystem* USkillCooldownSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<USkillCooldownSubsystem>() : nullptr;
+}
+
+bool USkillCooldownSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USkillCooldownSubsystem::Deinitialize()
+{
+	ExpiryTimes.Empty();
+	SlotInfos.Empty();
+	FreeSlots.Empty();
+	SlotLookup.Empty();
+
+	Super::Deinitialize();
+}
+
+double USkillCooldownSubsystem::GetCooldownTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	// Server time keeps client and server expiries comparable
+	if (const AGameStateBase* GameState = World->GetGameState())
+	{
+		return GameState->GetServerWorldTimeSeconds();
+	}
+
+	return World->GetTimeSeconds();
+}
+
+int32 USkillCooldownSubsystem::FindSlot(const UObject* Owner, FName CooldownID) const
+{
+	const int32* SlotIndex = SlotLookup.Find(FCooldownKey{ FObjectKey(Owner), CooldownID });
+	return SlotIndex ? *SlotIndex : INDEX_NONE;
+}
+
+int32 USkillCooldownSubsystem::AllocateSlot(const UObject* Owner, FName CooldownID)
+{
+	if (FreeSlots.Num() == 0 && ExpiryTimes.Num() >= NextPurgeSlotCount)
+	{
+		PurgeStaleOwners();
+		NextPurgeSlotCount = FMath::Max(64, SlotLookup.Num() * 2);
+	}
+
+	int32 SlotIndex = INDEX_NONE;
+	if (FreeSlots.Num() > 0)
+	{
+		SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotIndex = ExpiryTimes.Add(0.0);
+		SlotInfos.AddDefaulted();
+	}
+
+	const FCooldownKey Key{ FObjectKey(Owner), CooldownID };
+
+	ExpiryTimes[SlotIndex] = 0.0;
+	FCooldownSlotInfo& Info = SlotInfos[SlotIndex];
+	Info.Key = Key;
+	Info.Owner = Owner;
+	Info.bInUse = true;
+
+	SlotLookup.Add(Key, SlotIndex);
+	return SlotIndex;
+}
+
+void USkillCooldownSubsystem::PurgeStaleOwners()
+{
+	int32 NumPurged = 0;
+	for (int32 SlotIndex = 0; SlotIndex < SlotInfos.Num(); SlotIndex++)
+	{
+		FCooldownSlotInfo& Info = SlotInfos[SlotIndex];
+		if (Info.bInUse && !Info.Owner.IsValid())
+		{
+			SlotLookup.Remove(Info.Key);
+			Info.bInUse = false;
+			Info.Owner.Reset();
+			Info.Generation++; // Invalidates cached handles
+			ExpiryTimes[SlotIndex] = 0.0;
+			FreeSlots.Add(SlotIndex);
+			NumPurged++;
+		}
+	}
+
+	if (NumPurged > 0)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("SkillCooldownSubsystem::PurgeStaleOwners - Released %d cooldown slots"), NumPurged);
+	}
+}
+
+FCooldownHandle USkillCooldownSubsystem::FindOrAddCooldown(const UObject* Owner, FName CooldownID)
+{
+	FCooldownHandle Handle;
+	if (!Owner || CooldownID == NAME_None)
+	{
+		return Handle;
+	}
+
+	int32 SlotIndex = FindSlot(Owner, CooldownID);
+	if (SlotIndex == INDEX_NONE)
+	{
+		SlotIndex = AllocateSlot(Owner, CooldownID);
+	}
+
+	Handle.Index = SlotIndex;
+	Handle.Generation = SlotInfos[SlotIndex].Generation;
+	return Handle;
+}
+
+bool USkillCooldownSubsystem::IsHandleValid(const FCooldownHandle& Handle) const
+{
+	return SlotInfos.IsValidIndex(Handle.Index)
+		&& SlotInfos[Handle.Index].bInUse
+		&& SlotInfos[Handle.Index].Generation == Handle.Generation;
+}
+
+FCooldownHandle USkillCooldownSubsystem::StartCooldown(const UObject* Owner, FName CooldownID, float Duration)
+{
+	const FCooldownHandle Handle = FindOrAddCooldown(Owner, CooldownID);
+	StartCooldown(Handle, Duration);
+	return Handle;
+}
+
+void USkillCooldownSubsystem::StartCooldown(const FCooldownHandle& Handle, float Duration)
+{
+	if (Duration <= 0.0f || !IsHandleValid(Handle))
+	{
+		return;
+	}
+
+	double& ExpiryTime = ExpiryTimes[Handle.Index];
+	ExpiryTime = FMath::Max(ExpiryTime, GetCooldownTime() + Duration);
+}
+
+float USkillCooldownSubsystem::GetRemaining(const FCooldownHandle& Handle) const
+{
+	if (!IsHandleValid(Handle))
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(FMath::Max(0.0, ExpiryTimes[Handle.Index] - GetCooldownTime()));
+}
+
+float USkillCooldownSubsystem::GetCooldownRemaining(const UObject* Owner, FName CooldownID) const
+{
+	const int32 SlotIndex = FindSlot(Owner, CooldownID);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(FMath::Max(0.0, ExpiryTimes[SlotIndex] - GetCooldownTime()));
+}
+
+double USkillCooldownSubsystem::GetCooldownExpiry(const FCooldownHandle& Handle) const
+{
+	return IsHandleValid(Handle) ? ExpiryTimes[Handle.Index] : 0.0;
+}
+
+void USkillCooldownSubsystem::SetCooldownExpiry(const FCooldownHandle& Handle, double ExpiryTime)
+{
+	if (IsHandleValid(Handle))
+	{
+		ExpiryTimes[Handle.Index] = ExpiryTime;
+	}
+}
+
+void USkillCooldownSubsystem::ClearCooldown(const UObject* Owner, FName CooldownID)
+{
+	const int32 SlotIndex = FindSlot(Owner, CooldownID);
+	if (SlotIndex != INDEX_NONE)
+	{
+		ExpiryTimes[SlotIndex] = 0.0;
+	}
+}
+
+FName USkillCooldownSubsystem::GetSkillCooldownID(const USkillDataAsset& SkillData)
+{
+	return SkillData.SharedCooldownID != NAME_None ? SkillData.SharedCooldownID : SkillData.SkillID;
+}
+
+void USkillCooldownSubsystem::CommitSkillCooldown(const UObject* Owner, const USkillDataAsset& SkillData)
+{
+	StartCooldown(Owner, GetSkillCooldownID(SkillData), SkillData.CooldownDuration);
+
+	if (SkillData.CooldownGroup != NAME_None)
+	{
+		StartCooldown(Owner, SkillData.CooldownGroup, SkillData.CooldownGroupDuration);
+	}
+}
+
+float USkillCooldownSubsystem::GetSkillCooldownRemaining(const UObject* Owner, const USkillDataAsset& SkillData) const
+{
+	float Remaining = GetCooldownRemaining(Owner, GetSkillCooldownID(SkillData));
+	if (SkillData.CooldownGroup != NAME_None)
+	{
+		Remaining = FMath::Max(Remaining, GetCooldownRemaining(Owner, SkillData.CooldownGroup));
+	}
+	return Remaining;
+}
+
+FName USkillCooldownSubsystem::GetItemCooldownID(const UItemDataAsset& ItemData)
+{
+	return ItemData.CooldownGroup != NAME_None ? ItemData.CooldownGroup : ItemData.ItemID;
+}
+
+void USkillCooldownSubsystem::CommitItemCooldown(const UObject* Owner, const UItemDataAsset& ItemData)
+{
+	StartCooldown(Owner, GetItemCooldownID(ItemData), ItemData.CooldownDuration);
+}
+
+float USkillCooldownSubsystem::GetItemCooldownRemaining(const UObject* Owner, const UItemDataAsset* ItemData) const
+{
+	if (!ItemData || ItemData->CooldownDuration <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return GetCooldownRemaining(Owner, GetItemCooldownID(*ItemData));
+}
+
+void USkillCooldownSubsystem::ReportCooldowns() const
+{
+	const double Now = GetCooldownTime();
+
+	UE_LOG(LogTemp, Log, TEXT("=== SkillCooldownSubsystem: %d slots (%d free) ==="), ExpiryTimes.Num(), FreeSlots.Num());
+	for (int32 SlotIndex = 0; SlotIndex < SlotInfos.Num(); SlotIndex++)
+	{
+		const FCooldownSlotInfo& Info = SlotInfos[SlotIndex];
+		if (Info.bInUse && ExpiryTimes[SlotIndex] > Now)
+		{
+			const UObject* Owner = Info.Owner.Get();
+			UE_LOG(LogTemp, Log, TEXT("  - Owner: %s | Cooldown: %s | Remaining: %.2f"),
+				Owner ? *Owner->GetName() : TEXT("(destroyed)"),
+				*Info.Key.CooldownID.ToString(),
+				ExpiryTimes[SlotIndex] - Now);
+		}
+	}
+	UE_LOG(LogTemp, Log, TEXT("=== End Cooldown List ==="));
+}
@@ -0,0 +1,114 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Skills/Core/SkillActivation.h"
+#include "Skills/Projectiles/ProjectileSubsystem.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "GameFramework/Actor.h"
+
+void FSkillActivation::ResolveCooldownHandles(const FSkillSpec& Spec, USkillCooldownSubsystem& Cooldowns, const UObject* CooldownOwner,
+	FCooldownHandle& InOutCooldownHandle, FCooldownHandle& InOutGroupCooldownHandle)
+{
+	// Cached handles stay valid until their slot is recycled - re-resolving is the only hash lookup
+	if (!Cooldowns.IsHandleValid(InOutCooldownHandle))
+	{
+		InOutCooldownHandle = Cooldowns.FindOrAddCooldown(CooldownOwner, Spec.CooldownID);
+	}
+
+	if (Spec.CooldownGroup == NAME_None)
+	{
+		InOutGroupCooldownHandle.Reset();
+	}
+	else if (!Cooldowns.IsHandleValid(InOutGroupCooldownHandle))
+	{
+		InOutGroupCooldownHandle = Cooldowns.FindOrAddCooldown(CooldownOwner, Spec.CooldownGroup);
+	}
+}
+
+float FSkillActivation::GetCooldownRemaining(const USkillCooldownSubsystem& Cooldowns, const FCooldownHandle& CooldownHandle, const FCooldownHandle& GroupCooldownHandle)
+{
+	return FMath::Max(Cooldowns.GetRemaining(CooldownHandle), Cooldowns.GetRemaining(GroupCooldownHandle));
+}
+
+void FSkillActivation::CommitCooldown(const FSkillSpec& Spec, USkillCooldownSubsystem& Cooldowns, const FCooldownHandle& CooldownHandle,
+	const FCooldownHandle& GroupCooldownHandle, double& OutPreviousExpiry, double& OutPreviousGroupExpiry)
+{
+	OutPreviousExpiry = Cooldowns.GetCooldownExpiry(CooldownHandle);
+	OutPreviousGroupExpiry = Cooldowns.GetCooldownExpiry(GroupCooldownHandle);
+
+	// Absolute expiry time - nothing ticks it down
+	Cooldowns.StartCooldown(CooldownHandle, Spec.CooldownDuration);
+	Cooldowns.StartCooldown(GroupCooldownHandle, Spec.CooldownGroupDuration);
+}
+
+void FSkillActivation::RestoreCooldown(USkillCooldownSubsystem& Cooldowns, const FCooldownHandle& CooldownHandle, const FCooldownHandle& GroupCooldownHandle,
+	double PreviousExpiry, double PreviousGroupExpiry)
+{
+	Cooldowns.SetCooldownExpiry(CooldownHandle, PreviousExpiry);
+	Cooldowns.SetCooldownExpiry(GroupCooldownHandle, PreviousGroupExpiry);
+}
+
+bool FSkillActivation::CanAffordCosts(const FSkillSpec& Spec, const UAttributeComponent* Attributes)
+{
+	if (!Attributes || !Spec.HasCosts())
+	{
+		return true;
+	}
+
+	return Attributes->CanAfford(EActionRPGAttribute::Mana, Spec.ManaCost)
+		&& Attributes->CanAfford(EActionRPGAttribute::Stamina, Spec.StaminaCost);
+}
+
+bool FSkillActivation::CommitCosts(const FSkillSpec& Spec, UAttributeComponent* Attributes)
+{
+	if (!Attributes || !Spec.HasCosts())
+	{
+		return true;
+	}
+
+	if (!CanAffordCosts(Spec, Attributes))
+	{
+		UE_LOG(LogTemp, Log, TEXT("SkillActivation::CommitCosts - Cannot afford %s (Mana: %.1f, Stamina: %.1f)"),
+			*Spec.SkillID.ToString(), Spec.ManaCost, Spec.StaminaCost);
+		return false;
+	}
+
+	Attributes->Spend(EActionRPGAttribute::Mana, Spec.ManaCost);
+	Attributes->Spend(EActionRPGAttribute::Stamina, Spec.StaminaCost);
+	return true;
+}
+
+void FSkillActivation::RefundCosts(const FSkillSpec& Spec, UAttributeComponent* Attributes)
+{
+	if (!Attributes || !Spec.HasCosts())
+	{
+		return;
+	}
+
+	Attributes->ModifyValue(EActionRPGAttribute::Mana, Spec.ManaCost);
+	Attributes->ModifyValue(EActionRPGAttribute::Stamina, Spec.StaminaCost);
+}
+
+bool FSkillActivation::IsInRange(const FSkillSpec& Spec, const AActor& Caster, const AActor* Target, float Tolerance)
+{
+	if (!Target || Spec.Range <= 0.0f)
+	{
+		return true;
+	}
+
+	const float MaxRange = Spec.Range + Tolerance;
+	return FVector::DistSquared(Caster.GetActorLocation(), Target->GetActorLocation()) <= FMath::Square(MaxRange);
+}
+
+void FSkillActivation::Execute(const FSkillSpec& Spec, AActor& Caster, AActor* Target)
+{
+	// Projectile skills launch toward the target (or straight ahead)
+	if (Spec.ProjectileSpeed > 0.0f)
+	{
+		if (UProjectileSubsystem* Projectiles = UProjectileSubsystem::Get(&Caster))
+		{
+			const FVector Origin = Caster.GetActorLocation();
+			const FVector Direction = Target ? (Target->GetActorLocation() - Origin) : Caster.GetActorForwardVector();
+			Projectiles->LaunchProjectile(&Caster, Spec, Origin, Direction);
+		}
+	}
+}
@@ -1,11 +1,72 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "Skills/Core/SkillBase.h"
+#include "Skills/Core/SkillActivation.h"
+#include "Skills/Casting/SkillCastSubsystem.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "Characters/CharacterSpatialSubsystem.h"
+#include "Data/SkillDatabase.h"
+#include "GameFramework/Actor.h"
 
 USkillBase::USkillBase()
 {
 	SkillData = nullptr;
-	CooldownRemaining = 0.0f;
+	OwningActor = nullptr;
+}
+
+void USkillBase::SetOwningActor(AActor* NewOwner)
+{
+	if (OwningActor != NewOwner)
+	{
+		OwningActor = NewOwner;
+		CooldownHandle.Reset();
+		GroupCooldownHandle.Reset();
+		CooldownHandlesSkillData.Reset();
+	}
+}
+
+UWorld* USkillBase::GetWorld() const
+{
+	if (OwningActor)
+	{
+		return OwningActor->GetWorld();
+	}
+
+	// Skills outered to an actor fall back to the outer chain (the CDO has no world)
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		if (const AActor* OuterActor = GetTypedOuter<AActor>())
+		{
+			return OuterActor->GetWorld();
+		}
+	}
+
+	return nullptr;
+}
+
+const UObject* USkillBase::GetCooldownOwner() const
+{
+	return OwningActor ? static_cast<const UObject*>(OwningActor.Get()) : static_cast<const UObject*>(this);
+}
+
+const FSkillSpec* USkillBase::GetSkillSpec() const
+{
+	const USkillDatabase* SkillDB = SkillData ? USkillDatabase::Get(this) : nullptr;
+	const FSkillSpec* Spec = SkillDB ? SkillDB->GetSkillSpec(SkillData->RuntimeIndex) : nullptr;
+	return Spec && Spec->SkillData == SkillData ? Spec : nullptr;
+}
+
+void USkillBase::ResolveCooldownHandles(const FSkillSpec& Spec, USkillCooldownSubsystem& Cooldowns) const
+{
+	// Handles belong to the previous skill data if it was swapped
+	if (CooldownHandlesSkillData.Get() != SkillData)
+	{
+		CooldownHandle.Reset();
+		GroupCooldownHandle.Reset();
+		CooldownHandlesSkillData = SkillData;
+	}
+
+	FSkillActivation::ResolveCooldownHandles(Spec, Cooldowns, GetCooldownOwner(), CooldownHandle, GroupCooldownHandle);
 }
 
 USkillBase* USkillBase::Activate(AActor* Target)
@@ -16,45 +77,97 @@ USkillBase* USkillBase::Activate(AActor* Target)
 		return nullptr;
 	}
 
-	// Set cooldown
-	if (SkillData)
+	// Owned skills are cast (or queued behind the current cast); OnSkillActivated fires when the cast completes
+	if (OwningActor)
+	{
+		if (USkillCastSubsystem* CastSubsystem = USkillCastSubsystem::Get(this))
+		{
+			return CastSubsystem->BeginCast(this, Target) ? this : nullptr;
+		}
+	}
+
+	// No cast pipeline - activate instantly
+	const FSkillSpec* Spec = GetSkillSpec();
+	if (!Spec || !FSkillActivation::CommitCosts(*Spec, UAttributeComponent::FindAttributeComponent(OwningActor)))
 	{
-		CooldownRemaining = SkillData->CooldownDuration;
-		UE_LOG(LogTemp, Log, TEXT("SkillBase::Activate - Cooldown set: %.2f (from SkillData->CooldownDuration: %.2f)"), 
-			CooldownRemaining, SkillData->CooldownDuration);
+		return nullptr;
+	}
+
+	if (USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this))
+	{
+		ResolveCooldownHandles(*Spec, *Cooldowns);
+
+		double PreviousExpiry = 0.0;
+		double PreviousGroupExpiry = 0.0;
+		FSkillActivation::CommitCooldown(*Spec, *Cooldowns, CooldownHandle, GroupCooldownHandle, PreviousExpiry, PreviousGroupExpiry);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("SkillBase::Activate - SkillData is NULL, cannot set cooldown!"));
+		UE_LOG(LogTemp, Warning, TEXT("SkillBase::Activate - No cooldown manager for this skill's world, cannot set cooldown!"));
+	}
+
+	ExecuteSkill(Target);
+
+	// Return self to allow chaining in Blueprint
+	return this;
+}
+
+bool USkillBase::CanAffordCosts() const
+{
+	const FSkillSpec* Spec = GetSkillSpec();
+	return !Spec || FSkillActivation::CanAffordCosts(*Spec, UAttributeComponent::FindAttributeComponent(OwningActor));
+}
+
+int32 USkillBase::FindTargetsInRange(TArrayView<AActionRPGCharacter*> OutTargets) const
+{
+	const UCharacterSpatialSubsystem* Spatial = UCharacterSpatialSubsystem::Get(this);
+	if (!Spatial || !SkillData || !OwningActor)
+	{
+		return 0;
+	}
+
+	return Spatial->QueryRadius(OwningActor->GetActorLocation(), SkillData->Range, OutTargets, OwningActor);
+}
+
+void USkillBase::ExecuteSkill(AActor* Target)
+{
+	const FSkillSpec* Spec = GetSkillSpec();
+	if (Spec && OwningActor)
+	{
+		FSkillActivation::Execute(*Spec, *OwningActor, Target);
 	}
 
 	// Broadcast event
 	OnSkillActivated.Broadcast(this, Target);
 
-	UE_LOG(LogTemp, Log, TEXT("SkillBase::Activate - Skill activated: %s (Target: %s), CooldownRemaining: %.2f"), 
+	UE_LOG(LogTemp, Log, TEXT("SkillBase::ExecuteSkill - Skill activated: %s (Target: %s), CooldownRemaining: %.2f"), 
 		SkillData ? *SkillData->SkillName.ToString() : TEXT("NULL"),
 		Target ? *Target->GetName() : TEXT("None"),
-		CooldownRemaining);
-
-	// Return self to allow chaining in Blueprint
-	return this;
+		GetCooldownRemaining());
 }
 
 bool USkillBase::CanActivate(AActor* Target) const
 {
-	if (!SkillData)
+	// Skill data must be registered with the Skill Database
+	if (!GetSkillSpec())
 	{
 		return false;
 	}
 
 	// Check cooldown
-	if (CooldownRemaining > 0.0f)
+	if (GetCooldownRemaining() > 0.0f)
+	{
+		return false;
+	}
+
+	// Check mana/stamina
+	if (!CanAffordCosts())
 	{
 		return false;
 	}
 
 	// Base validation - can be overridden in derived classes
-	// Additional checks (mana, range, etc.) can be added here or in derived classes
+	// Additional checks (range, etc.) can be added here or in derived classes
 	return true;
 }
 
@@ -80,5 +193,14 @@ ESkillCategory USkillBase::GetSkillCategory() const
 
 float USkillBase::GetCooldownRemaining() const
 {
-	return CooldownRemaining;
+	const FSkillSpec* Spec = GetSkillSpec();
+	USkillCooldownSubsystem* Cooldowns = USkillCooldownSubsystem::Get(this);
+	if (!Spec || !Cooldowns)
+	{
+		return 0.0f;
+	}
+
+	ResolveCooldownHandles(*Spec, *Cooldowns);
+
+	return FSkillActivation::GetCooldownRemaining(*Cooldowns, CooldownHandle, GroupCooldownHandle);
 }
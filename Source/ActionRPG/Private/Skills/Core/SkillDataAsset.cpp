@@ -13,10 +13,20 @@ USkillDataAsset::USkillDataAsset()
 	Type = ESkillType::Utility;
 	Category = ESkillCategory::Combat;
 	CooldownDuration = 0.0f;
+	SharedCooldownID = NAME_None;
+	CooldownGroup = NAME_None;
+	CooldownGroupDuration = 0.0f;
 	ManaCost = 0.0f;
 	StaminaCost = 0.0f;
 	CastTime = 0.0f;
+	ChannelDuration = 0.0f;
+	RecoveryTime = 0.0f;
 	Range = 0.0f;
+	ProjectileSpeed = 0.0f;
+	ProjectileRadius = 20.0f;
+	ProjectileLifetime = 3.0f;
+	ProjectileVisualClass = nullptr;
+	RuntimeIndex = INDEX_NONE;
 }
 
 FPrimaryAssetId USkillDataAsset::GetPrimaryAssetId() const
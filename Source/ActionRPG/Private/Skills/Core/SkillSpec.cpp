@@ -0,0 +1,34 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Skills/Core/SkillSpec.h"
+#include "Skills/Core/SkillDataAsset.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
+
+FSkillSpec FSkillSpec::FromDataAsset(USkillDataAsset& InSkillData)
+{
+	FSkillSpec Spec;
+	Spec.SkillData = &InSkillData;
+	Spec.SkillIndex = InSkillData.RuntimeIndex;
+	Spec.SkillID = InSkillData.SkillID;
+	Spec.Type = InSkillData.Type;
+
+	Spec.CooldownID = USkillCooldownSubsystem::GetSkillCooldownID(InSkillData);
+	Spec.CooldownGroup = InSkillData.CooldownGroup;
+	Spec.CooldownDuration = InSkillData.CooldownDuration;
+	Spec.CooldownGroupDuration = InSkillData.CooldownGroup != NAME_None ? InSkillData.CooldownGroupDuration : 0.0f;
+
+	Spec.ManaCost = InSkillData.ManaCost;
+	Spec.StaminaCost = InSkillData.StaminaCost;
+
+	Spec.CastTime = InSkillData.CastTime;
+	Spec.ChannelDuration = InSkillData.ChannelDuration;
+	Spec.RecoveryTime = InSkillData.RecoveryTime;
+	Spec.Range = InSkillData.Range;
+
+	Spec.ProjectileSpeed = InSkillData.ProjectileSpeed;
+	Spec.ProjectileRadius = InSkillData.ProjectileRadius;
+	Spec.ProjectileLifetime = InSkillData.ProjectileLifetime;
+	Spec.ProjectileVisualClass = InSkillData.ProjectileVisualClass.Get();
+
+	return Spec;
+}
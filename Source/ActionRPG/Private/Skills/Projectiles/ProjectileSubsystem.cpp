@@ -0,0 +1,340 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "Skills/Projectiles/ProjectileSubsystem.h"
+#include "Skills/Core/SkillDataAsset.h"
+#include "Skills/Core/SkillSpec.h"
+#include "Data/SkillDatabase.h"
+#include "Characters/ActionRPGCharacter.h"
+#include "Characters/CharacterSpatialSubsystem.h"
+#include "Core/ActionRPGStats.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Projectile Update"), STAT_ProjectileUpdate, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Projectiles"), STAT_ActiveProjectiles, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectile Sweeps"), STAT_ProjectileSweeps, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Projectile Hits"), STAT_ProjectileHits, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Projectile Visuals Free"), STAT_ProjectileVisualsFree, STATGROUP_ActionRPG);
+
+namespace ProjectileSubsystemPrivate
+{
+	// Characters tested per projectile per frame
+	static constexpr int32 MaxCharacterCandidates = 16;
+}
+
+UProjectileSubsystem* UProjectileSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UProjectileSubsystem>() : nullptr;
+}
+
+bool UProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UProjectileSubsystem::Deinitialize()
+{
+	Positions.Empty();
+	Velocities.Empty();
+	RemainingLifetimes.Empty();
+	Radii.Empty();
+	Owners.Empty();
+	SkillIndices.Empty();
+	PendingSweeps.Empty();
+	PendingRemoval.Empty();
+	Visuals.Empty();
+	VisualPools.Empty();
+	PendingHits.Empty();
+
+	SET_DWORD_STAT(STAT_ActiveProjectiles, 0);
+	SET_DWORD_STAT(STAT_ProjectileVisualsFree, 0);
+
+	Super::Deinitialize();
+}
+
+TStatId UProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSubsystem, STATGROUP_Tickables);
+}
+
+bool UProjectileSubsystem::SpawnProjectile(AActor* Owner, USkillDataAsset* SkillData, FVector Location, FVector Direction)
+{
+	if (!SkillData)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProjectileSubsystem::SpawnProjectile - Invalid skill data"));
+		return false;
+	}
+
+	const USkillDatabase* SkillDB = USkillDatabase::Get(this);
+	const FSkillSpec* Spec = SkillDB ? SkillDB->GetSkillSpec(SkillData->RuntimeIndex) : nullptr;
+	return Spec && Spec->SkillData == SkillData
+		? LaunchProjectile(Owner, *Spec, Location, Direction)
+		: LaunchProjectile(Owner, FSkillSpec::FromDataAsset(*SkillData), Location, Direction);
+}
+
+bool UProjectileSubsystem::LaunchProjectile(AActor* Owner, const FSkillSpec& Spec, const FVector& Location, const FVector& Direction)
+{
+	UWorld* World = GetWorld();
+	if (!World || Spec.ProjectileSpeed <= 0.0f)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProjectileSubsystem::LaunchProjectile - Skill %s has no projectile speed"), *Spec.SkillID.ToString());
+		return false;
+	}
+
+	if (Positions.Num() >= MaxProjectiles)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ProjectileSubsystem::LaunchProjectile - Projectile cap reached (%d)"), MaxProjectiles);
+		return false;
+	}
+
+	const FVector SafeDirection = Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+
+	Positions.Add(Location);
+	Velocities.Add(SafeDirection * Spec.ProjectileSpeed);
+	RemainingLifetimes.Add(Spec.ProjectileLifetime);
+	Radii.Add(Spec.ProjectileRadius);
+	Owners.Add(Owner);
+	SkillIndices.Add(Spec.SkillIndex);
+	PendingSweeps.AddDefaulted();
+	PendingRemoval.Add(0);
+	Visuals.Add(Spec.ProjectileVisualClass
+		? AcquireVisual(*World, Spec.ProjectileVisualClass, Location, SafeDirection.Rotation())
+		: nullptr);
+
+	SET_DWORD_STAT(STAT_ActiveProjectiles, Positions.Num());
+	return true;
+}
+
+void UProjectileSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ProjectileUpdate);
+
+	UWorld* World = GetWorld();
+	if (!World || Positions.Num() == 0)
+	{
+		return;
+	}
+
+	PendingHits.Reset();
+
+	ResolveGeometrySweeps(*World);
+	Integrate(*World, DeltaTime);
+	FlushHitsAndExpired();
+	WriteVisualTransforms();
+
+	SET_DWORD_STAT(STAT_ActiveProjectiles, Positions.Num());
+}
+
+void UProjectileSubsystem::ResolveGeometrySweeps(UWorld& World)
+{
+	FTraceDatum SweepData;
+	for (int32 Index = 0; Index < Positions.Num(); Index++)
+	{
+		FTraceHandle& SweepHandle = PendingSweeps[Index];
+		if (!SweepHandle.IsValid())
+		{
+			continue;
+		}
+
+		if (World.QueryTraceData(SweepHandle, SweepData) && SweepData.OutHits.Num() > 0 && SweepData.OutHits[0].bBlockingHit)
+		{
+			const FHitResult& Hit = SweepData.OutHits[0];
+			PendingHits.Add({ Index, Hit.GetActor(), Hit.ImpactPoint });
+			PendingRemoval[Index] = 1;
+		}
+
+		SweepHandle = FTraceHandle();
+	}
+}
+
+void UProjectileSubsystem::Integrate(UWorld& World, float DeltaTime)
+{
+	using namespace ProjectileSubsystemPrivate;
+
+	const UCharacterSpatialSubsystem* Spatial = UCharacterSpatialSubsystem::Get(&World);
+	const FCollisionObjectQueryParams GeometryQuery(ECC_WorldStatic);
+
+	AActionRPGCharacter* CandidateBuffer[MaxCharacterCandidates];
+	const TArrayView<AActionRPGCharacter*> Candidates(CandidateBuffer, MaxCharacterCandidates);
+
+	for (int32 Index = 0; Index < Positions.Num(); Index++)
+	{
+		if (PendingRemoval[Index])
+		{
+			continue;
+		}
+
+		RemainingLifetimes[Index] -= DeltaTime;
+		if (RemainingLifetimes[Index] <= 0.0f)
+		{
+			PendingRemoval[Index] = 1;
+			continue;
+		}
+
+		const FVector Start = Positions[Index];
+		const FVector End = Start + Velocities[Index] * DeltaTime;
+		const AActor* Owner = Owners[Index].Get();
+		const float Radius = Radii[Index];
+
+		// Characters: the grid tests centres, so widen by the largest capsule and test each capsule exactly
+		if (Spatial)
+		{
+			const int32 NumCandidates = Spatial->QueryLine(Start, End, Radius + Spatial->GetMaxCharacterRadius(), Candidates, Owner);
+			const FVector Segment = End - Start;
+			const double SegmentLengthSq = FMath::Max(Segment.SizeSquared(), UE_DOUBLE_SMALL_NUMBER);
+
+			AActionRPGCharacter* ClosestCharacter = nullptr;
+			FVector HitLocation = End;
+			double ClosestT = TNumericLimits<double>::Max();
+			for (int32 CandidateIndex = 0; CandidateIndex < NumCandidates; CandidateIndex++)
+			{
+				AActionRPGCharacter* Candidate = Candidates[CandidateIndex];
+				const UCapsuleComponent* Capsule = Candidate->GetCapsuleComponent();
+				if (!Capsule)
+				{
+					continue;
+				}
+
+				// Sphere sweep vs capsule = segment-to-segment distance against the summed radii
+				const float CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+				const FVector AxisOffset = Capsule->GetUpVector() * (Capsule->GetScaledCapsuleHalfHeight() - CapsuleRadius);
+				const FVector CapsuleCenter = Capsule->GetComponentLocation();
+				FVector PathPoint;
+				FVector AxisPoint;
+				FMath::SegmentDistToSegmentSafe(Start, End, CapsuleCenter - AxisOffset, CapsuleCenter + AxisOffset, PathPoint, AxisPoint);
+				if (FVector::DistSquared(PathPoint, AxisPoint) > FMath::Square(static_cast<double>(Radius + CapsuleRadius)))
+				{
+					continue;
+				}
+
+				const double T = FVector::DotProduct(PathPoint - Start, Segment) / SegmentLengthSq;
+				if (T < ClosestT)
+				{
+					ClosestT = T;
+					ClosestCharacter = Candidate;
+					HitLocation = PathPoint;
+				}
+			}
+
+			if (ClosestCharacter)
+			{
+				PendingHits.Add({ Index, ClosestCharacter, HitLocation });
+				PendingRemoval[Index] = 1;
+				Positions[Index] = HitLocation;
+				continue;
+			}
+		}
+
+		// World geometry: batched async sweep, resolved next frame
+		FCollisionQueryParams SweepParams(SCENE_QUERY_STAT(ProjectileSweep), false, Owner);
+		PendingSweeps[Index] = World.AsyncSweepByObjectType(EAsyncTraceType::Single, Start, End, FQuat::Identity,
+			GeometryQuery, FCollisionShape::MakeSphere(Radius), SweepParams);
+		INC_DWORD_STAT(STAT_ProjectileSweeps);
+
+		Positions[Index] = End;
+	}
+}
+
+void UProjectileSubsystem::FlushHitsAndExpired()
+{
+	if (PendingHits.Num() > 0)
+	{
+		const USkillDatabase* SkillDB = USkillDatabase::Get(this);
+		for (const FPendingHit& Hit : PendingHits)
+		{
+			USkillDataAsset* SkillData = SkillDB ? SkillDB->GetSkillDataAssetByIndex(SkillIndices[Hit.ProjectileIndex]) : nullptr;
+			OnProjectileHit.Broadcast(Owners[Hit.ProjectileIndex].Get(), Hit.HitActor.Get(), SkillData, Hit.Location);
+			INC_DWORD_STAT(STAT_ProjectileHits);
+		}
+		PendingHits.Reset();
+	}
+
+	// Reverse order so swap-removes never move an unvisited row
+	for (int32 Index = Positions.Num() - 1; Index >= 0; Index--)
+	{
+		if (PendingRemoval[Index])
+		{
+			RemoveProjectileAt(Index);
+		}
+	}
+}
+
+void UProjectileSubsystem::WriteVisualTransforms()
+{
+	for (int32 Index = 0; Index < Visuals.Num(); Index++)
+	{
+		if (AActor* Visual = Visuals[Index])
+		{
+			Visual->SetActorLocationAndRotation(Positions[Index], Velocities[Index].Rotation(), false, nullptr, ETeleportType::TeleportPhysics);
+		}
+	}
+}
+
+void UProjectileSubsystem::RemoveProjectileAt(int32 Index)
+{
+	ReleaseVisual(Visuals[Index]);
+
+	Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	RemainingLifetimes.RemoveAtSwap(Index, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, EAllowShrinking::No);
+	Owners.RemoveAtSwap(Index, EAllowShrinking::No);
+	SkillIndices.RemoveAtSwap(Index, EAllowShrinking::No);
+	PendingSweeps.RemoveAtSwap(Index, EAllowShrinking::No);
+	PendingRemoval.RemoveAtSwap(Index, EAllowShrinking::No);
+	Visuals.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+AActor* UProjectileSubsystem::AcquireVisual(UWorld& World, TSubclassOf<AActor> VisualClass, const FVector& Location, const FRotator& Rotation)
+{
+	FProjectileVisualPool& Pool = VisualPools.FindOrAdd(VisualClass.Get());
+	while (Pool.FreeActors.Num() > 0)
+	{
+		AActor* Visual = Pool.FreeActors.Pop(EAllowShrinking::No);
+		if (IsValid(Visual))
+		{
+			Visual->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+			Visual->SetActorHiddenInGame(false);
+			DEC_DWORD_STAT(STAT_ProjectileVisualsFree);
+			return Visual;
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionMethod::AlwaysSpawn;
+
+	AActor* Visual = World.SpawnActor<AActor>(VisualClass, Location, Rotation, SpawnParams);
+	if (Visual)
+	{
+		// Purely cosmetic - the subsystem owns movement and collision
+		Visual->SetActorTickEnabled(false);
+		Visual->SetActorEnableCollision(false);
+	}
+	return Visual;
+}
+
+void UProjectileSubsystem::ReleaseVisual(AActor* Visual)
+{
+	if (!IsValid(Visual))
+	{
+		return;
+	}
+
+	FProjectileVisualPool& Pool = VisualPools.FindOrAdd(Visual->GetClass());
+	if (Pool.FreeActors.Num() >= MaxPooledVisualsPerClass)
+	{
+		Visual->Destroy();
+		return;
+	}
+
+	Visual->SetActorHiddenInGame(true);
+	Pool.FreeActors.Add(Visual);
+	INC_DWORD_STAT(STAT_ProjectileVisualsFree);
+}
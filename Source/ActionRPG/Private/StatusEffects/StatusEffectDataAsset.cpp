@@ -0,0 +1,21 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatusEffects/StatusEffectDataAsset.h"
+
+UStatusEffectDataAsset::UStatusEffectDataAsset()
+{
+	// Set default values
+	EffectID = NAME_None;
+	DisplayName = FText::GetEmpty();
+	Icon = nullptr;
+	bIsDebuff = false;
+	Duration = 10.0f;
+	MaxStacks = 1;
+	PeriodicAttribute = EActionRPGAttribute::Health;
+	PeriodicMagnitude = 0.0f;
+	Period = 1.0f;
+	ModifierAttribute = EActionRPGAttribute::Health;
+	ModifierTarget = EAttributeModifierTarget::RegenRate;
+	ModifierOp = EAttributeModifierOp::Additive;
+	ModifierMagnitude = 0.0f;
+}
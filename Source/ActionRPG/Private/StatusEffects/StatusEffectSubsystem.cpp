@@ -0,0 +1,505 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "StatusEffects/StatusEffectSubsystem.h"
+#include "StatusEffects/StatusEffectDataAsset.h"
+#include "Core/ActionRPGStats.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Status Effect Update"), STAT_StatusEffectUpdate, STATGROUP_ActionRPG);
+DECLARE_CYCLE_STAT(TEXT("Status Effect Commit"), STAT_StatusEffectCommit, STATGROUP_ActionRPG);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Status Effects"), STAT_ActiveStatusEffects, STATGROUP_ActionRPG);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Status Effect Periodic Ticks"), STAT_StatusEffectTicks, STATGROUP_ActionRPG);
+
+UStatusEffectSubsystem* UStatusEffectSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!GEngine || !WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UStatusEffectSubsystem>() : nullptr;
+}
+
+bool UStatusEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStatusEffectSubsystem::Deinitialize()
+{
+	DefinitionAssets.Empty();
+	Definitions.Empty();
+	DefinitionLookup.Empty();
+	Targets.Empty();
+	FreeTargets.Empty();
+	TargetLookup.Empty();
+	RowTargets.Empty();
+	RowDefinitions.Empty();
+	RowExpiryTimes.Empty();
+	RowNextTickTimes.Empty();
+	RowStacks.Empty();
+	RowModifiers.Empty();
+	RowTickCounts.Empty();
+	RowExpired.Empty();
+	CommitTargets.Empty();
+	PendingRemovals.Empty();
+	NextEventTime = TNumericLimits<double>::Max();
+
+	SET_DWORD_STAT(STAT_ActiveStatusEffects, 0);
+
+	Super::Deinitialize();
+}
+
+TStatId UStatusEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStatusEffectSubsystem, STATGROUP_Tickables);
+}
+
+double UStatusEffectSubsystem::GetEffectTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+int32 UStatusEffectSubsystem::FindDefinition(const UStatusEffectDataAsset* Effect) const
+{
+	const int32* DefinitionIndex = DefinitionLookup.Find(FObjectKey(Effect));
+	return DefinitionIndex ? *DefinitionIndex : INDEX_NONE;
+}
+
+int32 UStatusEffectSubsystem::FindOrAddDefinition(UStatusEffectDataAsset& Effect)
+{
+	const int32 ExistingIndex = FindDefinition(&Effect);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	FCompiledStatusEffect Compiled;
+	Compiled.Duration = Effect.Duration;
+	Compiled.MaxStacks = FMath::Max(Effect.MaxStacks, 1);
+	if (Effect.IsPeriodic())
+	{
+		Compiled.PeriodicAttribute = static_cast<int32>(Effect.PeriodicAttribute);
+		Compiled.PeriodicMagnitude = Effect.PeriodicMagnitude;
+		Compiled.Period = Effect.Period;
+	}
+	if (Effect.HasModifier())
+	{
+		Compiled.ModifierAttribute = Effect.ModifierAttribute;
+		Compiled.ModifierTarget = Effect.ModifierTarget;
+		Compiled.ModifierOp = Effect.ModifierOp;
+		Compiled.ModifierMagnitude = Effect.ModifierMagnitude;
+	}
+
+	const int32 DefinitionIndex = Definitions.Add(Compiled);
+	DefinitionAssets.Add(&Effect);
+	DefinitionLookup.Add(FObjectKey(&Effect), DefinitionIndex);
+	return DefinitionIndex;
+}
+
+int32 UStatusEffectSubsystem::FindTarget(const AActor* Actor) const
+{
+	const int32* TargetIndex = TargetLookup.Find(FObjectKey(Actor));
+	return TargetIndex ? *TargetIndex : INDEX_NONE;
+}
+
+int32 UStatusEffectSubsystem::FindOrAddTarget(AActor& Actor)
+{
+	const int32 ExistingIndex = FindTarget(&Actor);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		return ExistingIndex;
+	}
+
+	const int32 TargetIndex = FreeTargets.Num() > 0 ? FreeTargets.Pop(EAllowShrinking::No) : Targets.AddDefaulted();
+
+	FStatusEffectTarget& Target = Targets[TargetIndex];
+	Target.Actor = &Actor;
+	Target.Attributes = UAttributeComponent::FindAttributeComponent(&Actor);
+	Target.ActorKey = FObjectKey(&Actor);
+	Target.bInUse = true;
+
+	TargetLookup.Add(Target.ActorKey, TargetIndex);
+	Actor.OnEndPlay.AddUniqueDynamic(this, &UStatusEffectSubsystem::HandleTargetEndPlay);
+	return TargetIndex;
+}
+
+void UStatusEffectSubsystem::ReleaseTarget(int32 TargetIndex)
+{
+	if (AActor* Actor = Targets[TargetIndex].Actor.Get())
+	{
+		Actor->OnEndPlay.RemoveDynamic(this, &UStatusEffectSubsystem::HandleTargetEndPlay);
+	}
+
+	TargetLookup.Remove(Targets[TargetIndex].ActorKey);
+	Targets[TargetIndex] = FStatusEffectTarget();
+	FreeTargets.Add(TargetIndex);
+}
+
+void UStatusEffectSubsystem::HandleTargetEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	const int32 TargetIndex = FindTarget(Actor);
+	if (TargetIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Killed by a periodic delta - the rows are mid-commit, so let the commit remove them
+	if (bCommitting)
+	{
+		Targets[TargetIndex].bEndedPlay = true;
+		return;
+	}
+
+	RemoveAllStatusEffects(Actor);
+}
+
+int32 UStatusEffectSubsystem::FindRow(int32 TargetIndex, int32 DefinitionIndex) const
+{
+	if (TargetIndex == INDEX_NONE || DefinitionIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	for (const int32 Row : Targets[TargetIndex].Rows)
+	{
+		if (RowDefinitions[Row] == DefinitionIndex)
+		{
+			return Row;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UStatusEffectSubsystem::UpdateRowModifier(int32 Row)
+{
+	const FCompiledStatusEffect& Definition = Definitions[RowDefinitions[Row]];
+	UAttributeComponent* Attributes = Targets[RowTargets[Row]].Attributes.Get();
+	if (Definition.ModifierMagnitude == 0.0f || !Attributes)
+	{
+		return;
+	}
+
+	// Modifiers are immutable - swap in one scaled to the current stack count
+	if (RowModifiers[Row].IsValid())
+	{
+		Attributes->RemoveModifier(RowModifiers[Row]);
+	}
+	RowModifiers[Row] = Attributes->AddModifier(Definition.ModifierAttribute, Definition.ModifierTarget, Definition.ModifierOp,
+		Definition.ModifierMagnitude * RowStacks[Row]);
+}
+
+bool UStatusEffectSubsystem::ApplyStatusEffect(AActor* Target, UStatusEffectDataAsset* Effect, int32 Stacks)
+{
+	if (!Target || !Effect)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("StatusEffectSubsystem::ApplyStatusEffect - Invalid target or effect"));
+		return false;
+	}
+
+	const int32 DefinitionIndex = FindOrAddDefinition(*Effect);
+	const FCompiledStatusEffect& Definition = Definitions[DefinitionIndex];
+	const int32 TargetIndex = FindOrAddTarget(*Target);
+	const int32 AddedStacks = FMath::Max(Stacks, 1);
+
+	const double Now = GetEffectTime();
+	const double ExpiryTime = Definition.Duration > 0.0f ? Now + Definition.Duration : TNumericLimits<double>::Max();
+
+	int32 Row = FindRow(TargetIndex, DefinitionIndex);
+	if (Row == INDEX_NONE)
+	{
+		Row = RowTargets.Add(TargetIndex);
+		RowDefinitions.Add(DefinitionIndex);
+		RowExpiryTimes.Add(ExpiryTime);
+		RowNextTickTimes.Add(Definition.Period > 0.0 ? Now + Definition.Period : TNumericLimits<double>::Max());
+		RowStacks.Add(FMath::Min(AddedStacks, Definition.MaxStacks));
+		RowModifiers.AddDefaulted();
+		Targets[TargetIndex].Rows.Add(Row);
+
+		UpdateRowModifier(Row);
+	}
+	else
+	{
+		// Re-applying refreshes the duration; the periodic phase is kept
+		RowExpiryTimes[Row] = ExpiryTime;
+
+		const int32 NewStacks = FMath::Min(RowStacks[Row] + AddedStacks, Definition.MaxStacks);
+		if (NewStacks != RowStacks[Row])
+		{
+			RowStacks[Row] = NewStacks;
+			UpdateRowModifier(Row);
+		}
+	}
+
+	NextEventTime = FMath::Min(NextEventTime, FMath::Min(RowExpiryTimes[Row], RowNextTickTimes[Row]));
+	SET_DWORD_STAT(STAT_ActiveStatusEffects, RowTargets.Num());
+
+	OnStatusEffectApplied.Broadcast(Target, Effect, RowStacks[Row]);
+	return true;
+}
+
+bool UStatusEffectSubsystem::RemoveStatusEffect(AActor* Target, UStatusEffectDataAsset* Effect)
+{
+	const int32 Row = FindRow(FindTarget(Target), FindDefinition(Effect));
+	if (Row == INDEX_NONE)
+	{
+		return false;
+	}
+
+	RemoveRow(Row);
+	SET_DWORD_STAT(STAT_ActiveStatusEffects, RowTargets.Num());
+
+	OnStatusEffectRemoved.Broadcast(Target, Effect, 0);
+	return true;
+}
+
+void UStatusEffectSubsystem::RemoveAllStatusEffects(AActor* Target)
+{
+	const int32 TargetIndex = FindTarget(Target);
+	if (TargetIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TArray<UStatusEffectDataAsset*, TInlineAllocator<8>> RemovedEffects;
+	while (Targets[TargetIndex].bInUse && Targets[TargetIndex].Rows.Num() > 0)
+	{
+		const int32 Row = Targets[TargetIndex].Rows.Last();
+		RemovedEffects.Add(DefinitionAssets[RowDefinitions[Row]]);
+		RemoveRow(Row);
+	}
+	SET_DWORD_STAT(STAT_ActiveStatusEffects, RowTargets.Num());
+
+	for (UStatusEffectDataAsset* Effect : RemovedEffects)
+	{
+		OnStatusEffectRemoved.Broadcast(Target, Effect, 0);
+	}
+}
+
+void UStatusEffectSubsystem::RemoveRow(int32 Row)
+{
+	const int32 TargetIndex = RowTargets[Row];
+	FStatusEffectTarget& Target = Targets[TargetIndex];
+
+	if (RowModifiers[Row].IsValid())
+	{
+		if (UAttributeComponent* Attributes = Target.Attributes.Get())
+		{
+			Attributes->RemoveModifier(RowModifiers[Row]);
+		}
+	}
+
+	Target.Rows.RemoveSingleSwap(Row, EAllowShrinking::No);
+
+	// The last row moves into Row - repoint its target at the new index
+	const int32 LastRow = RowTargets.Num() - 1;
+	if (Row != LastRow)
+	{
+		FStatusEffectTarget& MovedTarget = Targets[RowTargets[LastRow]];
+		const int32 MovedSlot = MovedTarget.Rows.Find(LastRow);
+		if (MovedSlot != INDEX_NONE)
+		{
+			MovedTarget.Rows[MovedSlot] = Row;
+		}
+	}
+
+	RowTargets.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowDefinitions.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowExpiryTimes.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowNextTickTimes.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowStacks.RemoveAtSwap(Row, EAllowShrinking::No);
+	RowModifiers.RemoveAtSwap(Row, EAllowShrinking::No);
+
+	if (Target.Rows.Num() == 0)
+	{
+		ReleaseTarget(TargetIndex);
+	}
+}
+
+void UStatusEffectSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatusEffectUpdate);
+
+	if (RowTargets.Num() == 0)
+	{
+		return;
+	}
+
+	// Nothing expires or ticks before NextEventTime
+	const double Now = GetEffectTime();
+	if (Now < NextEventTime)
+	{
+		return;
+	}
+
+	RunUpdatePass(Now);
+	CommitUpdatePass();
+
+	SET_DWORD_STAT(STAT_ActiveStatusEffects, RowTargets.Num());
+
+	// Broadcast last - listeners may apply or remove effects
+	for (const FPendingRemoval& Removal : PendingRemovals)
+	{
+		if (AActor* Target = Removal.Target.Get())
+		{
+			OnStatusEffectRemoved.Broadcast(Target, DefinitionAssets[Removal.DefinitionIndex], 0);
+		}
+	}
+	PendingRemovals.Reset();
+}
+
+void UStatusEffectSubsystem::RunUpdatePass(double Now)
+{
+	const int32 NumRows = RowTargets.Num();
+	const int32 TaskSize = FMath::Max(RowsPerTask, 64);
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumRows, TaskSize);
+
+	RowTickCounts.SetNumUninitialized(NumRows, EAllowShrinking::No);
+	RowExpired.SetNumUninitialized(NumRows, EAllowShrinking::No);
+
+	TArray<double, TInlineAllocator<64>> TaskNextEventTimes;
+	TaskNextEventTimes.SetNumUninitialized(NumTasks);
+
+	// Each task reads the rows and definitions and writes only its own range of outputs
+	ParallelFor(NumTasks, [this, Now, NumRows, TaskSize, &TaskNextEventTimes](int32 TaskIndex)
+	{
+		const int32 FirstRow = TaskIndex * TaskSize;
+		const int32 EndRow = FMath::Min(FirstRow + TaskSize, NumRows);
+		double TaskNextEventTime = TNumericLimits<double>::Max();
+
+		for (int32 Row = FirstRow; Row < EndRow; Row++)
+		{
+			const double ExpiryTime = RowExpiryTimes[Row];
+			double& NextTickTime = RowNextTickTimes[Row];
+
+			// Periodic ticks due up to now (a tick landing exactly on expiry still counts)
+			int32 TickCount = 0;
+			const double Horizon = FMath::Min(Now, ExpiryTime);
+			if (NextTickTime <= Horizon)
+			{
+				const double Period = Definitions[RowDefinitions[Row]].Period;
+				TickCount = FMath::FloorToInt32((Horizon - NextTickTime) / Period) + 1;
+				NextTickTime += TickCount * Period;
+			}
+
+			const bool bExpired = ExpiryTime <= Now;
+			RowTickCounts[Row] = TickCount;
+			RowExpired[Row] = bExpired ? 1 : 0;
+
+			if (!bExpired)
+			{
+				TaskNextEventTime = FMath::Min(TaskNextEventTime, FMath::Min(ExpiryTime, NextTickTime));
+			}
+		}
+
+		TaskNextEventTimes[TaskIndex] = TaskNextEventTime;
+	}, NumRows < MinRowsForParallelUpdate ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	NextEventTime = TNumericLimits<double>::Max();
+	for (const double TaskNextEventTime : TaskNextEventTimes)
+	{
+		NextEventTime = FMath::Min(NextEventTime, TaskNextEventTime);
+	}
+}
+
+void UStatusEffectSubsystem::CommitUpdatePass()
+{
+	SCOPE_CYCLE_COUNTER(STAT_StatusEffectCommit);
+
+	// Sum periodic deltas per target and attribute
+	CommitTargets.Reset();
+	for (int32 Row = 0; Row < RowTargets.Num(); Row++)
+	{
+		const int32 TickCount = RowTickCounts[Row];
+		if (TickCount == 0)
+		{
+			continue;
+		}
+
+		const FCompiledStatusEffect& Definition = Definitions[RowDefinitions[Row]];
+		const int32 TargetIndex = RowTargets[Row];
+		FStatusEffectTarget& Target = Targets[TargetIndex];
+
+		Target.PendingDeltas[Definition.PeriodicAttribute] += Definition.PeriodicMagnitude * RowStacks[Row] * TickCount;
+		if (!Target.bHasPendingDeltas)
+		{
+			Target.bHasPendingDeltas = true;
+			CommitTargets.Add(TargetIndex);
+		}
+		INC_DWORD_STAT_BY(STAT_StatusEffectTicks, TickCount);
+	}
+
+	// One ModifyValue per target and attribute (change notifications are coalesced by the component)
+	bCommitting = true;
+	for (const int32 TargetIndex : CommitTargets)
+	{
+		FStatusEffectTarget& Target = Targets[TargetIndex];
+		if (UAttributeComponent* Attributes = Target.Attributes.Get())
+		{
+			for (int32 AttributeIndex = 0; AttributeIndex < NumAttributes; AttributeIndex++)
+			{
+				if (Target.PendingDeltas[AttributeIndex] != 0.0f)
+				{
+					Attributes->ModifyValue(static_cast<EActionRPGAttribute>(AttributeIndex), Target.PendingDeltas[AttributeIndex]);
+				}
+			}
+		}
+
+		FMemory::Memzero(Target.PendingDeltas);
+		Target.bHasPendingDeltas = false;
+	}
+	bCommitting = false;
+
+	// Remove expired rows and rows whose target is gone or ended play above. Reverse order so swap-removes only move visited rows.
+	for (int32 Row = RowTargets.Num() - 1; Row >= 0; Row--)
+	{
+		const FStatusEffectTarget& Target = Targets[RowTargets[Row]];
+		if (RowExpired[Row] || Target.bEndedPlay || !Target.Actor.IsValid())
+		{
+			PendingRemovals.Add({ Target.Actor, RowDefinitions[Row] });
+			RemoveRow(Row);
+		}
+	}
+}
+
+int32 UStatusEffectSubsystem::GetStatusEffectStacks(const AActor* Target, const UStatusEffectDataAsset* Effect) const
+{
+	const int32 Row = FindRow(FindTarget(Target), FindDefinition(Effect));
+	return Row != INDEX_NONE ? RowStacks[Row] : 0;
+}
+
+float UStatusEffectSubsystem::GetStatusEffectTimeRemaining(const AActor* Target, const UStatusEffectDataAsset* Effect) const
+{
+	const int32 Row = FindRow(FindTarget(Target), FindDefinition(Effect));
+	if (Row == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	if (RowExpiryTimes[Row] == TNumericLimits<double>::Max())
+	{
+		return -1.0f;
+	}
+
+	return static_cast<float>(FMath::Max(RowExpiryTimes[Row] - GetEffectTime(), 0.0));
+}
+
+TArray<UStatusEffectDataAsset*> UStatusEffectSubsystem::GetStatusEffects(const AActor* Target) const
+{
+	TArray<UStatusEffectDataAsset*> Result;
+
+	const int32 TargetIndex = FindTarget(Target);
+	if (TargetIndex != INDEX_NONE)
+	{
+		for (const int32 Row : Targets[TargetIndex].Rows)
+		{
+			Result.Add(DefinitionAssets[RowDefinitions[Row]]);
+		}
+	}
+	return Result;
+}
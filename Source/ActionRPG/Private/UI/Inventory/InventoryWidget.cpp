@@ -9,6 +9,7 @@
 #include "UI/Inventory/InventoryContextMenuWidget.h"
 #include "Components/Inventory/InventoryComponent.h"
 #include "Characters/ActionRPGPlayerCharacter.h"
+#include "Core/GroundHeightSubsystem.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/CameraComponent.h"
 #include "Engine/World.h"
@@ -64,10 +65,12 @@ void UInventoryWidget::NativeConstruct()
 		InventoryComponent->OnInventoryChanged.RemoveDynamic(this, &UInventoryWidget::OnInventoryChanged);
 		InventoryComponent->OnItemAdded.RemoveDynamic(this, &UInventoryWidget::OnItemAdded);
 		InventoryComponent->OnItemRemoved.RemoveDynamic(this, &UInventoryWidget::OnItemRemoved);
+		InventoryComponent->OnInventoryBulkChanged.RemoveDynamic(this, &UInventoryWidget::OnInventoryBulkChanged);
 		
 		InventoryComponent->OnInventoryChanged.AddDynamic(this, &UInventoryWidget::OnInventoryChanged);
 		InventoryComponent->OnItemAdded.AddDynamic(this, &UInventoryWidget::OnItemAdded);
 		InventoryComponent->OnItemRemoved.AddDynamic(this, &UInventoryWidget::OnItemRemoved);
+		InventoryComponent->OnInventoryBulkChanged.AddDynamic(this, &UInventoryWidget::OnInventoryBulkChanged);
 		
 		UE_LOG(LogTemp, Log, TEXT("InventoryWidget::NativeConstruct - Bound to InventoryComponent events"));
 	}
@@ -112,6 +115,7 @@ void UInventoryWidget::NativeDestruct()
 		InventoryComponent->OnInventoryChanged.RemoveDynamic(this, &UInventoryWidget::OnInventoryChanged);
 		InventoryComponent->OnItemAdded.RemoveDynamic(this, &UInventoryWidget::OnItemAdded);
 		InventoryComponent->OnItemRemoved.RemoveDynamic(this, &UInventoryWidget::OnItemRemoved);
+		InventoryComponent->OnInventoryBulkChanged.RemoveDynamic(this, &UInventoryWidget::OnInventoryBulkChanged);
 	}
 
 	// Clear slot widgets
@@ -316,34 +320,14 @@ void UInventoryWidget::DropItemFromContextMenu(int32 SlotIndex)
 	FVector DropLocation = PlayerLocation + (ForwardVector * DropDistance);
 	DropLocation.Z = PlayerLocation.Z; // Keep at player's height initially
 
-	// Trace down to find ground level (same as HandleDragToWorld)
-	UWorld* World = GetWorld();
-	if (World)
+	// Find ground level from the ground height cache (same as HandleDragToWorld); it only traces for unseen ground
+	UGroundHeightSubsystem* GroundHeight = UGroundHeightSubsystem::Get(this);
+	float GroundZ = 0.0f;
+	if (GroundHeight && GroundHeight->GetGroundHeight(DropLocation, PlayerLocation.Z, GroundZ, PlayerCharacter))
 	{
-		FVector TraceStart = DropLocation;
-		TraceStart.Z += 500.0f; // Start trace 500 units above
-		FVector TraceEnd = DropLocation;
-		TraceEnd.Z -= 1000.0f; // Trace down 1000 units
-
-		FHitResult HitResult;
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(PlayerCharacter);
-		QueryParams.bTraceComplex = false;
-
-		// First try WorldStatic collision channel
-		if (World->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
-		{
-			DropLocation = HitResult.ImpactPoint;
-			DropLocation.Z += 5.0f; // Add small offset above ground
-		}
-		// If no static collision, try WorldDynamic
-		else if (World->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldDynamic, QueryParams))
-		{
-			DropLocation = HitResult.ImpactPoint;
-			DropLocation.Z += 5.0f; // Add small offset above ground
-		}
-		// If no collision found, keep at player's height
+		DropLocation.Z = GroundZ + 5.0f; // Add small offset above ground
 	}
+	// If no ground found, keep at player's height
 
 	// Drop item
 	bool bDropped = InventoryComponent->DropItemToWorld(SlotIndex, Quantity, DropLocation);
@@ -604,6 +588,14 @@ void UInventoryWidget::OnItemAdded(UItemBase* Item)
 	UpdateInventoryDisplay();
 }
 
+void UInventoryWidget::OnInventoryBulkChanged(const TArray<int32>& SlotIndices)
+{
+	UE_LOG(LogTemp, Verbose, TEXT("InventoryWidget::OnInventoryBulkChanged - %d slots changed"), SlotIndices.Num());
+
+	// One refresh for the whole batch
+	UpdateInventoryDisplay();
+}
+
 void UInventoryWidget::OnItemRemoved(UItemBase* Item, int32 Quantity)
 {
 	UE_LOG(LogTemp, Verbose, TEXT("InventoryWidget::OnItemRemoved - Item removed: %s (Quantity: %d)"), 
@@ -1112,58 +1104,24 @@ void UInventoryWidget::HandleDragToWorld(UItemDragDropOperation* DragOperation,
 		}
 	}
 
-	// Find actual ground level at drop location using line trace
-	UWorld* World = GetWorld();
-	if (World)
+	// Find actual ground level at drop location
+	// The ground height cache answers from earlier samples nearby and only traces (WorldStatic, then
+	// WorldDynamic for platforms) for ground it hasn't seen, searching from 500 units above to 1000 below the player
+	UGroundHeightSubsystem* GroundHeight = UGroundHeightSubsystem::Get(this);
+	float GroundZ = 0.0f;
+	if (GroundHeight && GroundHeight->GetGroundHeight(DropLocation, PlayerLocation.Z, GroundZ, PlayerCharacter))
 	{
-		// Trace downward from above the drop location to find ground
-		// Start from a high point (player location + 500 units) to ensure we're above terrain
-		FVector TraceStart = DropLocation;
-		TraceStart.Z = FMath::Max(PlayerLocation.Z + 500.0f, DropLocation.Z + 500.0f);
-		
-		// Trace down to well below the player (player Z - 1000 units) to find ground
-		FVector TraceEnd = DropLocation;
-		TraceEnd.Z = PlayerLocation.Z - 1000.0f;
-		
-		// Use world's LineTraceSingleByChannel - FHitResult and FCollisionQueryParams should be available through Engine/World.h
-		FHitResult HitResult;
-		FCollisionQueryParams QueryParams;
-		QueryParams.AddIgnoredActor(PlayerCharacter); // Ignore player character
-		QueryParams.bTraceComplex = false; // Use simple collision for performance
-		
-		// Trace against world static objects (ground, terrain, etc.)
-		if (World->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldStatic, QueryParams))
-		{
-			// Found ground - use hit location, but add a small offset above ground to prevent clipping
-			DropLocation = HitResult.ImpactPoint;
-			DropLocation.Z += 5.0f; // Small offset to place item slightly above ground
-			UE_LOG(LogTemp, Log, TEXT("InventoryWidget::HandleDragToWorld - Found ground at Z=%.2f (adjusted to %.2f) using line trace"), 
-				HitResult.ImpactPoint.Z, DropLocation.Z);
-		}
-		else
-		{
-			// Try tracing against WorldDynamic as fallback (for platforms, etc.)
-			if (World->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_WorldDynamic, QueryParams))
-			{
-				DropLocation = HitResult.ImpactPoint;
-				DropLocation.Z += 5.0f; // Small offset above ground
-				UE_LOG(LogTemp, Log, TEXT("InventoryWidget::HandleDragToWorld - Found surface (WorldDynamic) at Z=%.2f (adjusted to %.2f)"), 
-					HitResult.ImpactPoint.Z, DropLocation.Z);
-			}
-			else
-			{
-				// No ground found - use player's Z as fallback (but still try to place on ground plane)
-				// For top-down games, player Z is usually at ground level
-				DropLocation.Z = PlayerLocation.Z;
-				UE_LOG(LogTemp, Warning, TEXT("InventoryWidget::HandleDragToWorld - No ground found via line trace, using player Z=%.2f as fallback"), DropLocation.Z);
-			}
-		}
+		// Found ground - add a small offset above ground to prevent clipping
+		DropLocation.Z = GroundZ + 5.0f;
+		UE_LOG(LogTemp, Log, TEXT("InventoryWidget::HandleDragToWorld - Found ground at Z=%.2f (adjusted to %.2f)"), 
+			GroundZ, DropLocation.Z);
 	}
 	else
 	{
-		// No world - use player's Z as fallback
+		// No ground found - use player's Z as fallback
+		// For top-down games, player Z is usually at ground level
 		DropLocation.Z = PlayerLocation.Z;
-		UE_LOG(LogTemp, Warning, TEXT("InventoryWidget::HandleDragToWorld - World is null, using player Z=%.2f as fallback"), DropLocation.Z);
+		UE_LOG(LogTemp, Warning, TEXT("InventoryWidget::HandleDragToWorld - No ground found, using player Z=%.2f as fallback"), DropLocation.Z);
 	}
 
 	// Log drop attempt
@@ -30,6 +30,7 @@ void UQuickUseBarWidget::NativeConstruct()
 	
 	// Bind to inventory changed event to update quick-use slots when item quantities change
 	InventoryComponent->OnInventoryChanged.AddDynamic(this, &UQuickUseBarWidget::OnInventoryChangedInternal);
+	InventoryComponent->OnInventoryBulkChanged.AddDynamic(this, &UQuickUseBarWidget::OnInventoryBulkChangedInternal);
 
 	// Initialize slot widgets
 	InitializeSlots();
@@ -47,6 +48,7 @@ void UQuickUseBarWidget::NativeDestruct()
 	{
 		InventoryComponent->OnQuickUseSlotChanged.RemoveAll(this);
 		InventoryComponent->OnInventoryChanged.RemoveAll(this);
+		InventoryComponent->OnInventoryBulkChanged.RemoveAll(this);
 	}
 
 	Super::NativeDestruct();
@@ -98,6 +100,24 @@ void UQuickUseBarWidget::OnInventoryChangedInternal(int32 SlotIndex, UItemBase*
 	}
 }
 
+void UQuickUseBarWidget::OnInventoryBulkChangedInternal(const TArray<int32>& SlotIndices)
+{
+	if (!InventoryComponent)
+	{
+		return;
+	}
+
+	// Refresh each quick-use slot once, however many of its inventory slots changed
+	for (int32 i = 0; i < 10; i++)
+	{
+		FQuickUseSlot QuickSlot = InventoryComponent->GetQuickUseSlot(i);
+		if (SlotIndices.Contains(QuickSlot.InventorySlotIndex))
+		{
+			RefreshSlot(i);
+		}
+	}
+}
+
 void UQuickUseBarWidget::InitializeSlots()
 {
 	if (!QuickUseGrid)
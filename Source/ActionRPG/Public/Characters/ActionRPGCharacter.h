@@ -6,6 +6,10 @@
 #include "GameFramework/Character.h"
 #include "ActionRPGCharacter.generated.h"
 
+class UAttributeComponent;
+class USkillComponent;
+class UComboComponent;
+
 /**
  * Base Character class for ActionRPG.
  * All characters (player and NPCs) inherit from this class.
@@ -19,7 +23,20 @@ class ACTIONRPG_API AActionRPGCharacter : public ACharacter
 public:
 	AActionRPGCharacter(const FObjectInitializer& ObjectInitializer);
 
+	// Health, mana and stamina (shared by players and NPCs)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UAttributeComponent> AttributeComponent;
+
+	// Skill slots and networked skill activation
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<USkillComponent> SkillComponent;
+
+	// Attack chains and skill follow-ups
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+	TObjectPtr<UComboComponent> ComboComponent;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 };
 
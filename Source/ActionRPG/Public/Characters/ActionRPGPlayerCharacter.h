@@ -37,22 +37,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Components", meta = (InstanceEditable = "true"))
 	TObjectPtr<class UInventoryComponent> InventoryComponent;
 
-	// Health Stats
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats", meta = (ClampMin = "0.0", ClampMax = "1000.0"))
-	float MaxHealth = 100.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stats", meta = (ClampMin = "0.0"))
-	float CurrentHealth = 50.0f;
-
-	// Health Functions
+	// Health Functions (health lives on the AttributeComponent)
 	UFUNCTION(BlueprintCallable, Category = "Stats")
 	void Heal(float HealAmount);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stats")
-	bool IsHealthAtMax() const { return CurrentHealth >= MaxHealth; }
+	bool IsHealthAtMax() const;
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Stats")
-	float GetHealthPercent() const { return MaxHealth > 0.0f ? CurrentHealth / MaxHealth : 0.0f; }
+	float GetHealthPercent() const;
 
 protected:
 	virtual void BeginPlay() override;
@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Core/UniformGridIndex.h"
+#include "CharacterSpatialSubsystem.generated.h"
+
+class AActionRPGCharacter;
+
+/**
+ * Spatial index of every ActionRPG character in the world, used for skill targeting.
+ * Characters register on BeginPlay and are re-bucketed from their root component's
+ * TransformUpdated event, so the index is always current without any tick or per-frame rebuild.
+ *
+ * Radius, cone and line queries only visit nearby grid cells and write into a caller-provided
+ * buffer, e.g.:
+ *   TArray<AActionRPGCharacter*, TInlineAllocator<64>> Targets;
+ *   Targets.SetNumUninitialized(64);
+ *   Targets.SetNum(Spatial->QueryRadius(Center, Radius, Targets, Caster));
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UCharacterSpatialSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the spatial index for the world of the given context object (nullptr if unavailable)
+	static UCharacterSpatialSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Registration (called by AActionRPGCharacter on BeginPlay/EndPlay)
+	void RegisterCharacter(AActionRPGCharacter* Character);
+	void UnregisterCharacter(AActionRPGCharacter* Character);
+
+	// Queries - results are written to OutCharacters; return the number written (capped by its size)
+	int32 QueryRadius(const FVector& Center, float Radius, TArrayView<AActionRPGCharacter*> OutCharacters, const AActor* IgnoreActor = nullptr) const;
+	int32 QueryCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees, TArrayView<AActionRPGCharacter*> OutCharacters, const AActor* IgnoreActor = nullptr) const;
+	int32 QueryLine(const FVector& Start, const FVector& End, float HalfWidth, TArrayView<AActionRPGCharacter*> OutCharacters, const AActor* IgnoreActor = nullptr) const;
+
+	// Blueprint convenience (allocates the result array)
+	UFUNCTION(BlueprintCallable, Category = "Targeting")
+	void FindCharactersInRadius(FVector Center, float Radius, TArray<AActionRPGCharacter*>& OutCharacters, const AActor* IgnoreActor = nullptr, int32 MaxResults = 256) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Targeting")
+	int32 GetNumRegisteredCharacters() const { return Grid.Num(); }
+
+	// Largest capsule radius of any character registered so far. Queries test character centres,
+	// so callers that need to hit capsules widen their query by this much and test the capsule themselves.
+	float GetMaxCharacterRadius() const { return MaxCharacterRadius; }
+
+protected:
+	// Grid cell edge length in world units (roughly the most common query radius)
+	UPROPERTY(Config, EditAnywhere, Category = "Targeting", meta = (ClampMin = "50.0"))
+	float CellSize = 500.0f;
+
+private:
+	void HandleTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 GridId);
+
+	struct FRegistration
+	{
+		int32 GridId = INDEX_NONE;
+		TWeakObjectPtr<USceneComponent> RootComponent;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	// Characters are unregistered on EndPlay, so raw pointers in the grid never dangle
+	TUniformGridIndex<AActionRPGCharacter*> Grid;
+	TMap<TObjectKey<AActionRPGCharacter>, FRegistration> Registrations;
+
+	// Never shrinks - a stale, larger value only widens queries
+	float MaxCharacterRadius = 0.0f;
+};
@@ -0,0 +1,104 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Combat/ComboTypes.h"
+#include "Combat/ComboTable.h"
+#include "ComboGraphDataAsset.generated.h"
+
+class UAnimMontage;
+
+/**
+ * Edge of a combo graph: pressing Input moves to NextState.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FComboTransitionDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	EComboInput Input;
+
+	// StateName of the target state
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	FName NextState;
+
+	FComboTransitionDefinition()
+		: Input(EComboInput::Attack), NextState(NAME_None)
+	{}
+};
+
+/**
+ * Node of a combo graph: one attack (or skill follow-up) of a chain.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FComboStateDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	FName StateName;
+
+	// Played on the character when the state is entered
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	TObjectPtr<UAnimMontage> Montage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	FName MontageSection;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo", meta = (ClampMin = "0.01"))
+	float PlayRate;
+
+	// Seconds until the chain resets to the entry state (0 = montage length)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo", meta = (ClampMin = "0.0"))
+	float Duration;
+
+	// Seconds after entering the state during which transitions are accepted
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo", meta = (ClampMin = "0.0"))
+	float WindowOpen;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo", meta = (ClampMin = "0.0"))
+	float WindowClose;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	TArray<FComboTransitionDefinition> Transitions;
+
+	FComboStateDefinition()
+		: StateName(NAME_None), Montage(nullptr), MontageSection(NAME_None), PlayRate(1.0f)
+		, Duration(0.0f), WindowOpen(0.3f), WindowClose(0.8f)
+	{}
+};
+
+/**
+ * Data Asset describing a combo graph (attack chains and skill follow-ups).
+ * The graph is compiled into an FComboTable the first time it is used and whenever it is edited;
+ * the Combo Component only ever evaluates the compiled table.
+ */
+UCLASS(BlueprintType)
+class ACTIONRPG_API UComboGraphDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UComboGraphDataAsset();
+
+	// Transitions out of the idle (entry) state - these start a chain
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	TArray<FComboTransitionDefinition> EntryTransitions;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	TArray<FComboStateDefinition> States;
+
+	// Compiled table (built on first call)
+	const FComboTable& GetComboTable();
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	FComboTable ComboTable;
+	bool bComboTableBuilt;
+};
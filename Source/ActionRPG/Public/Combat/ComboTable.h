@@ -0,0 +1,63 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Combat/ComboTypes.h"
+
+class UAnimMontage;
+class UComboGraphDataAsset;
+
+// Outcome of feeding an input to a combo state
+enum class EComboStep : uint8
+{
+	Advanced,		// Moved to the next state
+	WindowNotOpen,	// A transition exists but its window hasn't opened yet (worth buffering)
+	NoTransition	// Nothing to do for this input
+};
+
+/**
+ * Combo graph compiled into flat tables.
+ * State 0 is the entry (idle) state; authored state N is table state N + 1. NextStates holds one
+ * row of NumComboInputs entries per state, so evaluating an input is a bounds check, a window test
+ * and one array read - no allocation, no branching over the authored graph.
+ */
+struct ACTIONRPG_API FComboTable
+{
+	static constexpr int32 EntryState = 0;
+	static constexpr int32 NumInputs = static_cast<int32>(EComboInput::Count);
+
+	// Build from an authored graph (unknown transition targets are logged and dropped)
+	void Build(const UComboGraphDataAsset& Graph);
+
+	void Reset();
+
+	bool IsEmpty() const { return NumStates <= 1; }
+	bool IsValidState(int32 State) const { return State >= 0 && State < NumStates; }
+
+	/**
+	 * Evaluate an input against a state.
+	 * A state whose duration has run out is treated as the entry state.
+	 * @param State			Current state
+	 * @param TimeInState	Seconds since the state was entered
+	 * @param Input			Input pressed
+	 * @param OutNextState	State to enter when Advanced is returned
+	 */
+	EComboStep Evaluate(int32 State, float TimeInState, EComboInput Input, int32& OutNextState) const;
+
+	int32 NumStates = 0;
+
+	// NumStates x NumInputs, INDEX_NONE = no transition
+	TArray<int32> NextStates;
+
+	// Per state: input window and total length (seconds since entering the state)
+	TArray<float> WindowOpenTimes;
+	TArray<float> WindowCloseTimes;
+	TArray<float> Durations;
+
+	// Per state: what entering it plays
+	TArray<FName> StateNames;
+	TArray<UAnimMontage*> Montages;
+	TArray<FName> MontageSections;
+	TArray<float> PlayRates;
+};
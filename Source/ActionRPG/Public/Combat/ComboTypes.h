@@ -0,0 +1,22 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ComboTypes.generated.h"
+
+// Inputs a combo graph reacts to
+UENUM(BlueprintType)
+enum class EComboInput : uint8
+{
+	Attack			UMETA(DisplayName = "Attack"),
+	SkillSlot1		UMETA(DisplayName = "Skill Slot 1"),
+	SkillSlot2		UMETA(DisplayName = "Skill Slot 2"),
+	SkillSlot3		UMETA(DisplayName = "Skill Slot 3"),
+	SkillSlot4		UMETA(DisplayName = "Skill Slot 4"),
+	SkillSlot5		UMETA(DisplayName = "Skill Slot 5"),
+	SkillSlot6		UMETA(DisplayName = "Skill Slot 6"),
+	SkillSlot7		UMETA(DisplayName = "Skill Slot 7"),
+	SkillSlot8		UMETA(DisplayName = "Skill Slot 8"),
+	Count			UMETA(Hidden)
+};
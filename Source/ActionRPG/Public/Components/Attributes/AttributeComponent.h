@@ -0,0 +1,223 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AttributeComponent.generated.h"
+
+/**
+ * Attributes tracked by the Attribute Component.
+ * The component stores them in a fixed array indexed by this enum.
+ */
+UENUM(BlueprintType)
+enum class EActionRPGAttribute : uint8
+{
+	Health		UMETA(DisplayName = "Health"),
+	Mana		UMETA(DisplayName = "Mana"),
+	Stamina		UMETA(DisplayName = "Stamina"),
+	Count		UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EAttributeModifierTarget : uint8
+{
+	MaxValue	UMETA(DisplayName = "Max Value"),
+	RegenRate	UMETA(DisplayName = "Regen Rate")
+};
+
+UENUM(BlueprintType)
+enum class EAttributeModifierOp : uint8
+{
+	Additive		UMETA(DisplayName = "Additive"),		// Base + Magnitude
+	Multiplicative	UMETA(DisplayName = "Multiplicative")	// Magnitudes summed, then (Base + Additive) * (1 + Sum)
+};
+
+/**
+ * Authored starting values of a single attribute.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FAttributeDefaults
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes", meta = (ClampMin = "0.0"))
+	float MaxValue;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes", meta = (ClampMin = "0.0"))
+	float InitialValue;
+
+	// Points per second (negative values drain)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
+	float RegenPerSecond;
+
+	// Seconds regen pauses after the attribute is reduced
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes", meta = (ClampMin = "0.0"))
+	float RegenDelay;
+
+	FAttributeDefaults()
+		: MaxValue(100.0f), InitialValue(100.0f), RegenPerSecond(0.0f), RegenDelay(0.0f)
+	{}
+
+	FAttributeDefaults(float InMaxValue, float InInitialValue, float InRegenPerSecond, float InRegenDelay)
+		: MaxValue(InMaxValue), InitialValue(InInitialValue), RegenPerSecond(InRegenPerSecond), RegenDelay(InRegenDelay)
+	{}
+};
+
+/**
+ * Handle to a modifier added to an Attribute Component.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FAttributeModifierHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ModifierID = INDEX_NONE;
+
+	bool IsValid() const { return ModifierID != INDEX_NONE; }
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAttributeChanged, EActionRPGAttribute, Attribute, float, NewValue, float, MaxValue);
+
+/**
+ * Attribute Component for health, mana and stamina.
+ * Works on any actor (player or NPC) and never ticks:
+ * - Each attribute stores an anchor (value + time). Regen is evaluated from the anchor on read,
+ *   so a regenerating attribute costs nothing until someone looks at it.
+ * - Max value and regen rate are Base modified by a stack of additive/multiplicative modifiers,
+ *   recomputed only when a modifier is added or removed.
+ * - OnAttributeChanged is coalesced: any number of changes in a frame produce one broadcast per
+ *   changed attribute on the next tick. Regen alone does not broadcast - UI reads GetValue.
+ */
+UCLASS(BlueprintType, Blueprintable, meta = (BlueprintSpawnableComponent))
+class ACTIONRPG_API UAttributeComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAttributeComponent();
+
+	// Find the attribute component of an actor (nullptr if it has none)
+	static UAttributeComponent* FindAttributeComponent(const AActor* Actor);
+
+	// Component lifecycle
+	virtual void InitializeComponent() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// Reset every attribute to its authored defaults and drop all modifiers
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void ResetAttributes();
+
+	// Queries
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	float GetValue(EActionRPGAttribute Attribute) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	float GetMaxValue(EActionRPGAttribute Attribute) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	float GetRegenRate(EActionRPGAttribute Attribute) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	float GetPercent(EActionRPGAttribute Attribute) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	bool IsAtMax(EActionRPGAttribute Attribute) const;
+
+	// Changes
+	// Add Delta (clamped to [0, Max]); returns the amount actually applied. Reductions pause regen.
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	float ModifyValue(EActionRPGAttribute Attribute, float Delta);
+
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	void SetValue(EActionRPGAttribute Attribute, float NewValue);
+
+	// Correct a predicted value to the server's (clamped to [0, Max]); unlike SetValue, never pauses regen
+	void ApplyServerValue(EActionRPGAttribute Attribute, float ServerValue);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Attributes")
+	bool CanAfford(EActionRPGAttribute Attribute, float Cost) const;
+
+	// Spend Cost if the attribute can afford it; returns false (and changes nothing) otherwise
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	bool Spend(EActionRPGAttribute Attribute, float Cost);
+
+	// Modifiers
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	FAttributeModifierHandle AddModifier(EActionRPGAttribute Attribute, EAttributeModifierTarget Target, EAttributeModifierOp Op, float Magnitude);
+
+	UFUNCTION(BlueprintCallable, Category = "Attributes")
+	bool RemoveModifier(FAttributeModifierHandle Handle);
+
+	// Fired once per frame per changed attribute
+	UPROPERTY(BlueprintAssignable, Category = "Attributes")
+	FOnAttributeChanged OnAttributeChanged;
+
+	// Authored defaults
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
+	FAttributeDefaults HealthDefaults;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
+	FAttributeDefaults ManaDefaults;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Attributes")
+	FAttributeDefaults StaminaDefaults;
+
+private:
+	static constexpr int32 NumAttributes = static_cast<int32>(EActionRPGAttribute::Count);
+
+	struct FAttributeState
+	{
+		// Base values (from defaults)
+		float BaseMax = 0.0f;
+		float BaseRegen = 0.0f;
+		float RegenDelay = 0.0f;
+
+		// Effective values after modifiers
+		float Max = 0.0f;
+		float Regen = 0.0f;
+
+		// Value at AnchorTime; regen accrues from max(AnchorTime, RegenResumeTime)
+		double AnchorValue = 0.0;
+		double AnchorTime = 0.0;
+		double RegenResumeTime = 0.0;
+	};
+
+	struct FAttributeModifier
+	{
+		int32 ModifierID = INDEX_NONE;
+		EActionRPGAttribute Attribute = EActionRPGAttribute::Health;
+		EAttributeModifierTarget Target = EAttributeModifierTarget::MaxValue;
+		EAttributeModifierOp Op = EAttributeModifierOp::Additive;
+		float Magnitude = 0.0f;
+	};
+
+	const FAttributeDefaults& GetDefaults(EActionRPGAttribute Attribute) const;
+
+	double GetAttributeTime() const;
+
+	static bool IsValidAttribute(EActionRPGAttribute Attribute) { return static_cast<int32>(Attribute) < NumAttributes; }
+
+	// Lazily evaluate the current value from the anchor
+	static double EvaluateValue(const FAttributeState& State, double Now);
+
+	// Move the anchor to Now (call before changing Max/Regen so accrued regen is kept)
+	static void Rebase(FAttributeState& State, double Now);
+
+	// Recompute Max/Regen of one attribute from its base and the modifier stack
+	void RecomputeModifiers(EActionRPGAttribute Attribute);
+
+	// Queue a change notification for the next tick
+	void MarkDirty(EActionRPGAttribute Attribute);
+	void FlushNotifications();
+
+	FAttributeState States[NumAttributes];
+
+	TArray<FAttributeModifier> Modifiers;
+	int32 NextModifierID = 0;
+
+	// Bit per attribute changed since the last flush
+	uint8 DirtyMask = 0;
+	bool bNotificationPending = false;
+};
@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Combat/ComboTable.h"
+#include "ComboComponent.generated.h"
+
+class UComboGraphDataAsset;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnComboStateChanged, FName, StateName);
+
+/**
+ * Combo Component - tracks where a character is in its combo graph.
+ * Runtime state is a table state index and the time it was entered; inputs are resolved with a
+ * single FComboTable lookup. Nothing ticks - a state that has run out is detected on the next input.
+ * Inputs arriving before a window opens report WindowNotOpen so the caller can buffer them.
+ */
+UCLASS(BlueprintType, Blueprintable, meta = (BlueprintSpawnableComponent))
+class ACTIONRPG_API UComboComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UComboComponent();
+
+	// Component lifecycle
+	virtual void BeginPlay() override;
+
+	// Feed an input to the combo graph; plays the next state's montage on Advanced
+	EComboStep HandleComboInput(EComboInput Input);
+
+	UFUNCTION(BlueprintCallable, Category = "Combo")
+	bool TryComboInput(EComboInput Input) { return HandleComboInput(Input) == EComboStep::Advanced; }
+
+	// Back to the entry state (e.g. when hit or stunned)
+	UFUNCTION(BlueprintCallable, Category = "Combo")
+	void ResetCombo();
+
+	// Current state name (None when idle)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Combo")
+	FName GetComboStateName() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Combo")
+	void SetComboGraph(UComboGraphDataAsset* NewComboGraph);
+
+	UPROPERTY(BlueprintAssignable, Category = "Combo")
+	FOnComboStateChanged OnComboStateChanged;
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combo")
+	TObjectPtr<UComboGraphDataAsset> ComboGraph;
+
+private:
+	float GetTimeInState() const;
+
+	void EnterState(const FComboTable& ComboTable, int32 State);
+
+	// Compiled table of ComboGraph (owned by the asset). Fetched on every use, never cached - editing
+	// the asset resets and rebuilds it.
+	const FComboTable* GetComboTable() const;
+
+	int32 CurrentState;
+	double StateEnterTime;
+};
@@ -30,6 +30,25 @@ struct ACTIONRPG_API FInventorySlot
 	{}
 };
 
+/**
+ * One item of a bulk add (see UInventoryComponent::AddItemsBulk).
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FInventoryAddRequest
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Inventory")
+	TObjectPtr<UItemDataAsset> ItemData;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Inventory")
+	int32 Quantity;
+
+	FInventoryAddRequest()
+		: ItemData(nullptr), Quantity(0)
+	{}
+};
+
 /**
  * Enum for quick-use slot type.
  * Slots 1-8 are for skills (Phase 3), slots 9-10 are for consumables (Phase 2).
@@ -85,6 +104,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool AddItem(UItemBase* Item, int32 Quantity = 1);
 
+	// Add several items in one pass (e.g. an auto-pickup sweep). Weight and free slots are counted
+	// once for the batch; each request goes in whole or not at all, in order. Fires a single
+	// OnInventoryBulkChanged instead of per-slot events. OutAccepted[i] tells whether Requests[i]
+	// was added. Returns the number of requests added.
+	int32 AddItemsBulk(TConstArrayView<FInventoryAddRequest> Requests, TArray<bool>& OutAccepted);
+
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	bool RemoveItem(int32 SlotIndex, int32 Quantity = 1);
 
@@ -167,6 +192,7 @@ public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnItemRemoved, UItemBase*, Item, int32, Quantity);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemUsed, UItemBase*, Item);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnQuickUseSlotChanged, int32, QuickUseSlotIndex, UItemBase*, Item);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventoryBulkChanged, const TArray<int32>&, SlotIndices);
 
 	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events", meta = (DisplayName = "On Inventory Changed"))
 	FOnInventoryChanged OnInventoryChanged;
@@ -174,6 +200,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events", meta = (DisplayName = "On Item Added"))
 	FOnItemAdded OnItemAdded;
 
+	// Several slots changed at once (AddItemsBulk)
+	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events", meta = (DisplayName = "On Inventory Bulk Changed"))
+	FOnInventoryBulkChanged OnInventoryBulkChanged;
+
 	UPROPERTY(BlueprintAssignable, Category = "Inventory|Events", meta = (DisplayName = "On Item Removed"))
 	FOnItemRemoved OnItemRemoved;
 
@@ -203,4 +233,8 @@ private:
 	int32 FindEmptySlot() const;
 	void UpdateSlotEmptyStatus(int32 SlotIndex);
 	void BroadcastInventoryChanged(int32 SlotIndex, UItemBase* Item);
+
+	// Item instance pooling (falls back to NewObject when no pool is available)
+	UItemBase* AcquireItemInstance(UItemDataAsset* ItemData, int32 Quantity);
+	void ReleaseItemInstance(UItemBase* Item);
 };
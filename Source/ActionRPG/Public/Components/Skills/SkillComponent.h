@@ -0,0 +1,147 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Skills/Core/SkillLoadout.h"
+#include "SkillComponent.generated.h"
+
+class USkillDataAsset;
+class USkillCooldownSubsystem;
+struct FSkillSpec;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSkillCosmetic, USkillDataAsset*, SkillData, AActor*, Target);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSkillActivationRejected, USkillDataAsset*, SkillData);
+
+/**
+ * Skill Component - owns a character's skill slots and networks skill activation.
+ * Slots are an FSkillLoadout (spec indexes + cooldown handles) over the shared FSkillSpecs - no
+ * per-character skill UObjects - and activation runs through FSkillActivation and the cast pipeline.
+ *
+ * Activation flow (owning client):
+ * 1. The client activates the skill locally right away (cast, cooldown and cost are predicted)
+ *    and sends ServerActivateSkill with a prediction key.
+ * 2. The server validates cost, cooldown (with a small latency tolerance) and range, then runs
+ *    the activation authoritatively and answers ClientConfirmActivation or ClientRejectActivation.
+ * 3. On reject the client rolls the prediction back: the cast is interrupted (or the queued skill
+ *    cleared) and the predicted cooldown and resource spend are restored.
+ * Confirm and reject carry the server's mana and stamina; the client adopts them (minus spends
+ * of its later predictions the server hadn't seen yet), so predicted resources can't drift.
+ * Other clients receive an unreliable MulticastSkillCosmetic (slot index + target) for VFX.
+ *
+ * The server (and standalone/listen host) activates directly without prediction.
+ */
+UCLASS(BlueprintType, Blueprintable, meta = (BlueprintSpawnableComponent))
+class ACTIONRPG_API USkillComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USkillComponent();
+
+	static constexpr int32 NumSkillSlots = 8;
+
+	// Component lifecycle
+	virtual void BeginPlay() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	// Activate the skill in a slot (0-7). Predicted on owning clients, authoritative on the server.
+	UFUNCTION(BlueprintCallable, Category = "Skills")
+	bool ActivateSkillSlot(int32 SlotIndex, AActor* Target = nullptr);
+
+	// Authority only: put a skill in a slot (NAME_None clears it)
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Skills")
+	void SetSkillInSlot(int32 SlotIndex, FName SkillID);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skills")
+	USkillDataAsset* GetSkillDataInSlot(int32 SlotIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Skills")
+	float GetSlotCooldownRemaining(int32 SlotIndex);
+
+	const FSkillLoadout& GetLoadout() const { return Loadout; }
+
+	// Fired on remote clients when this character activates a skill (cosmetics only)
+	UPROPERTY(BlueprintAssignable, Category = "Skills")
+	FOnSkillCosmetic OnSkillCosmetic;
+
+	// Fired on the owning client when the server rejects a predicted activation
+	UPROPERTY(BlueprintAssignable, Category = "Skills")
+	FOnSkillActivationRejected OnSkillActivationRejected;
+
+protected:
+	// Skills placed in slots 0-7 when play begins
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skills")
+	TArray<FName> DefaultSkillIDs;
+
+	// Server accepts activations whose cooldown has at most this many seconds left (client clock runs ahead by ~1 RTT/2)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skills|Network", meta = (ClampMin = "0.0"))
+	float CooldownTolerance = 0.15f;
+
+	// Extra range granted to client requests to absorb position lag
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skills|Network", meta = (ClampMin = "0.0"))
+	float RangeTolerance = 75.0f;
+
+	// Skill IDs per slot (replicated; every machine resolves them into its own loadout)
+	UPROPERTY(ReplicatedUsing = OnRep_SlotSkillIDs)
+	TArray<FName> SlotSkillIDs;
+
+	UFUNCTION()
+	void OnRep_SlotSkillIDs();
+
+	// RPCs
+	UFUNCTION(Server, Reliable)
+	void ServerActivateSkill(uint8 SlotIndex, AActor* Target, uint16 PredictionKey);
+
+	UFUNCTION(Client, Reliable)
+	void ClientConfirmActivation(uint16 PredictionKey, float ServerMana, float ServerStamina);
+
+	UFUNCTION(Client, Reliable)
+	void ClientRejectActivation(uint16 PredictionKey, float ServerMana, float ServerStamina);
+
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastSkillCosmetic(uint8 SlotIndex, AActor* Target);
+
+private:
+	struct FPredictedSkillActivation
+	{
+		uint16 PredictionKey = 0;
+		uint8 SlotIndex = 0;
+		double PreviousCooldownExpiry = 0.0;
+		double PreviousGroupCooldownExpiry = 0.0;
+	};
+
+	const FSkillSpec* GetSlotSpec(int32 SlotIndex) const;
+
+	// Resolve the slot's cached cooldown handles; nullptr if the world has no cooldown manager
+	USkillCooldownSubsystem* ResolveSlotCooldowns(int32 SlotIndex, const FSkillSpec& Spec);
+
+	// Server-side checks; cooldown and range tolerances only apply to requests from a remote client
+	bool ValidateActivation(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target, bool bRemoteRequest);
+
+	// Cast the slot's skill (or activate it instantly without a cast pipeline)
+	bool ActivateSlot(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target);
+
+	// Run the activation with authority and tell other clients
+	bool ActivateAuthoritative(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target);
+
+	// Run a remote client's request, forgiving the cooldown left within CooldownTolerance (kept if the activation fails)
+	bool ActivateRemoteRequest(int32 SlotIndex, const FSkillSpec& Spec, AActor* Target);
+
+	void RollbackPrediction(const FPredictedSkillActivation& Prediction);
+
+	// Adopt the server's mana/stamina, keeping what still-pending predictions have spent locally
+	void ReconcileResources(float ServerMana, float ServerStamina);
+
+	// Resolve SlotSkillIDs into the loadout's spec indexes
+	void RebuildLoadout();
+
+	UFUNCTION()
+	void HandleDataReady();
+
+	FSkillLoadout Loadout;
+
+	TArray<FPredictedSkillActivation> PendingPredictions;
+	uint16 NextPredictionKey = 1;
+};
@@ -11,11 +11,72 @@ class UInputMappingContext;
 class UInputAction;
 class UUserWidget;
 class UInventoryWidget;
+class AItemPickupActor;
+class AActionRPGPlayerCharacter;
+struct FInputActionInstance;
+
+// What a slot input activates
+UENUM(BlueprintType)
+enum class ESlotInputType : uint8
+{
+	SkillSlot		UMETA(DisplayName = "Skill Slot"),
+	QuickUseSlot	UMETA(DisplayName = "Quick-Use Slot"),
+	Attack			UMETA(DisplayName = "Attack (Combo)")
+};
+
+// Outcome of running a slot input
+enum class ESlotInputResult : uint8
+{
+	Executed,	// The input ran
+	Retry,		// Can't run yet - cooldown or combo window (worth buffering)
+	Failed		// Won't run by waiting - empty slot, unusable item (dropped)
+};
+
+/**
+ * One row of the slot input table: an Input Action and the skill or quick-use slot it activates.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FSlotInputBinding
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	TObjectPtr<UInputAction> Action;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	ESlotInputType Type;
+
+	// Skill slot (0-7) or inventory quick-use slot (0-9); unused for Attack
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input", meta = (ClampMin = "0"))
+	int32 SlotIndex;
+
+	// Keep a press that can't run yet (cooldown, cast lockout) and run it once it can
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
+	bool bBufferable;
+
+	FSlotInputBinding()
+		: Action(nullptr), Type(ESlotInputType::SkillSlot), SlotIndex(0), bBufferable(true)
+	{
+	}
+
+	FSlotInputBinding(UInputAction* InAction, ESlotInputType InType, int32 InSlotIndex)
+		: Action(InAction), Type(InType), SlotIndex(InSlotIndex), bBufferable(true)
+	{
+	}
+};
 
 /**
  * PlayerController for ActionRPG.
  * Handles Enhanced Input System integration and routes input to the player character.
  * Supports movement, look, and action inputs (interact, attack, dodge, inventory, skill slots 1-8).
+ *
+ * Skill and quick-use slots are driven by the SlotInputBindings table, bound once per press
+ * (ETriggerEvent::Started) through a single handler. A press that can't run yet (cooldown, combo
+ * window) is buffered with its timestamp and retried every frame until it runs, fails for good or
+ * InputBufferWindow runs out; presses that can never succeed are dropped right away. The buffer
+ * holds one press per slot type - a newer press replaces the older one, and repeats of the same
+ * press only refresh its timestamp. Attack presses go through the same path into the pawn's Combo
+ * Component, so a press made before the next combo window opens is buffered until it does.
  */
 UCLASS()
 class ACTIONRPG_API AActionRPGPlayerController : public APlayerController
@@ -43,6 +104,7 @@ public:
 protected:
 	virtual void BeginPlay() override;
 	virtual void SetupInputComponent() override;
+	virtual void PlayerTick(float DeltaTime) override;
 
 	// Enhanced Input
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input")
@@ -73,7 +135,15 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UInventoryWidget> InventoryWidget;
 
-	// Skill Slot Input Actions
+	// Skill and quick-use slot inputs. If empty, built from the per-slot actions below.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Slots")
+	TArray<FSlotInputBinding> SlotInputBindings;
+
+	// Seconds a press that couldn't run yet stays buffered (0 = no buffering)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Slots", meta = (ClampMin = "0.0"))
+	float InputBufferWindow = 0.35f;
+
+	// Skill Slot Input Actions (legacy - used only when SlotInputBindings is empty)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Skills")
 	TObjectPtr<UInputAction> SkillSlot1Action;
 
@@ -98,7 +168,7 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Skills")
 	TObjectPtr<UInputAction> SkillSlot8Action;
 
-	// Quick-Use Bar Input Actions (for consumables - Phase 2)
+	// Quick-Use Bar Input Actions (legacy - used only when SlotInputBindings is empty)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Input|Quick Use")
 	TObjectPtr<UInputAction> QuickUseSlot9Action;
 
@@ -109,25 +179,44 @@ protected:
 	void OnMove(const FInputActionValue& Value);
 	void OnLook(const FInputActionValue& Value);
 	void OnInteract();
-	void OnAttack();
 	void OnDodge();
 	void OnOpenInventory();
 
-	// Skill Slot Handlers
-	void OnSkillSlot1();
-	void OnSkillSlot2();
-	void OnSkillSlot3();
-	void OnSkillSlot4();
-	void OnSkillSlot5();
-	void OnSkillSlot6();
-	void OnSkillSlot7();
-	void OnSkillSlot8();
-
-	// Quick-Use Bar Handlers (for consumables - Phase 2)
-	UFUNCTION()
-	void OnQuickUseSlot9(const FInputActionValue& Value);
-
-	UFUNCTION()
-	void OnQuickUseSlot10(const FInputActionValue& Value);
+	// Pickups are server-owned - a client's Interact press is carried out here
+	UFUNCTION(Server, Reliable)
+	void ServerInteractWithPickup(AItemPickupActor* Pickup);
+
+	// Authority: pick up the target of an Interact press (a stored item materialized for it goes back into storage on failure)
+	void InteractWithPickup(AActionRPGPlayerCharacter& PlayerCharacter, AItemPickupActor& Pickup, bool bMaterialized);
+
+	// Slot Handlers (skills routed to the pawn's SkillComponent, quick-use to its InventoryComponent)
+	void OnSlotInputStarted(const FInputActionInstance& Instance);
+	ESlotInputResult ActivateSkillSlot(int32 SlotIndex);
+	ESlotInputResult UseQuickUseSlot(int32 SlotIndex);
+	ESlotInputResult PerformAttack();
+
+	// Run a slot binding now
+	ESlotInputResult ExecuteSlotBinding(const FSlotInputBinding& Binding);
+
+private:
+	struct FBufferedSlotInput
+	{
+		int32 BindingIndex = INDEX_NONE;
+		double Timestamp = 0.0;
+	};
+
+	// Fill SlotInputBindings from the per-slot action properties
+	void BuildLegacySlotInputBindings();
+
+	// Add AttackAction to SlotInputBindings unless a binding already uses it
+	void AddAttackSlotInputBinding();
+
+	void BufferSlotInput(int32 BindingIndex);
+
+	// Retry buffered presses, dropping the ones that ran or expired
+	void FlushInputBuffer();
+
+	// Pending presses, at most one per slot type
+	TArray<FBufferedSlotInput, TInlineAllocator<2>> InputBuffer;
 };
 
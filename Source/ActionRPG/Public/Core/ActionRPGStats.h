@@ -0,0 +1,12 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stat group shared by ActionRPG runtime systems.
+ * View in game with "stat ActionRPG".
+ */
+DECLARE_STATS_GROUP(TEXT("ActionRPG"), STATGROUP_ActionRPG, STATCAT_Advanced);
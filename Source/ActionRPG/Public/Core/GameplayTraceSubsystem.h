@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CollisionQueryParams.h"
+#include "CollisionShape.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "GameplayTraceSubsystem.generated.h"
+
+// Receives the result of a deferred trace (Hit is only meaningful when bBlockingHit is true)
+using FGameplayTraceCallback = TUniqueFunction<void(bool bBlockingHit, const FHitResult& Hit)>;
+
+/**
+ * Shared entry point for gameplay traces (ground under drops, cursor and targeting queries).
+ * Deferred requests are handed to the world's async trace batch, which runs them on worker
+ * threads at the end of the frame; their callbacks run from this subsystem's tick the next frame.
+ * At most MaxAsyncTracesPerFrame are submitted per frame - the rest wait in a queue, so a burst
+ * of requests spreads over several frames instead of stalling one.
+ * Callers that need an answer right away use the synchronous fallbacks, which trace on the game thread.
+ * "stat ActionRPG" shows async and sync trace counts per frame.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UGameplayTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the trace service for the world of the given context object (nullptr if unavailable)
+	static UGameplayTraceSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Deferred single line trace; Callback runs next frame (or later if the frame's budget is spent)
+	void RequestLineTrace(const FVector& Start, const FVector& End, ECollisionChannel Channel,
+		const FCollisionQueryParams& Params, FGameplayTraceCallback&& Callback);
+
+	// Deferred single sweep of Shape from Start to End
+	void RequestSweep(const FVector& Start, const FVector& End, const FCollisionShape& Shape, ECollisionChannel Channel,
+		const FCollisionQueryParams& Params, FGameplayTraceCallback&& Callback);
+
+	// Synchronous fallbacks for callers that can't wait a frame
+	bool LineTraceSync(FHitResult& OutHit, const FVector& Start, const FVector& End, ECollisionChannel Channel,
+		const FCollisionQueryParams& Params);
+
+	bool SweepSync(FHitResult& OutHit, const FVector& Start, const FVector& End, const FCollisionShape& Shape,
+		ECollisionChannel Channel, const FCollisionQueryParams& Params);
+
+	// Trace counts of the previous full frame
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Traces")
+	int32 GetNumAsyncTracesLastFrame() const { return AsyncTracesLastFrame; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Traces")
+	int32 GetNumSyncTracesLastFrame() const { return SyncTracesLastFrame; }
+
+	// Requests waiting for a frame with budget left
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Traces")
+	int32 GetNumQueuedTraces() const { return QueuedTraces.Num(); }
+
+protected:
+	// Async traces submitted per frame; further requests wait for the next frame
+	UPROPERTY(Config, EditAnywhere, Category = "Traces", meta = (ClampMin = "1"))
+	int32 MaxAsyncTracesPerFrame = 128;
+
+private:
+	struct FQueuedTrace
+	{
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		FCollisionShape Shape;
+		ECollisionChannel Channel = ECC_Visibility;
+		FCollisionQueryParams Params;
+		FGameplayTraceCallback Callback;
+	};
+
+	struct FInFlightTrace
+	{
+		FTraceHandle Handle;
+		FGameplayTraceCallback Callback;
+
+		// Results are readable from the frame after this one
+		uint64 SubmitFrame = 0;
+	};
+
+	// Submit now if the frame has budget left, otherwise queue
+	void AddRequest(FQueuedTrace&& Request);
+	void SubmitTrace(UWorld& World, FQueuedTrace&& Request);
+
+	// Run the callbacks of traces submitted in earlier frames
+	void DeliverResults(UWorld& World);
+
+	// Roll the per-frame counters over when a new frame starts
+	void UpdateFrameCounters();
+
+	// Waiting for budget, oldest first
+	TArray<FQueuedTrace> QueuedTraces;
+
+	// Submitted to the world; results readable from the next frame
+	TArray<FInFlightTrace> InFlightTraces;
+
+	// Scratch, swapped with InFlightTraces while delivering (callbacks may request new traces)
+	TArray<FInFlightTrace> DeliveringTraces;
+
+	uint64 CountedFrame = 0;
+	int32 AsyncTracesThisFrame = 0;
+	int32 SyncTracesThisFrame = 0;
+	int32 AsyncTracesLastFrame = 0;
+	int32 SyncTracesLastFrame = 0;
+};
@@ -0,0 +1,106 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GroundHeightSubsystem.generated.h"
+
+class ULevel;
+
+/**
+ * Coarse cache of ground heights for placing things on the floor (item drops, loot scatter).
+ * The world is split into CellSize x CellSize columns. The first query in a column traces down
+ * through the Gameplay Trace Subsystem and keeps the hit point and surface normal, so later
+ * queries anywhere in that column are answered from the cached plane without a trace.
+ * A sample is only reused for queries whose reference height is within MaxStepHeight of it, so
+ * bridges and multi-storey areas trace again rather than snapping to the wrong floor.
+ * Only ground with Static mobility is cached - anything that may move (WorldDynamic surfaces, or
+ * movable actors blocking the WorldStatic channel) is traced every time.
+ * Cells are filled lazily (or ahead of time with PrefetchArea) and dropped for the region of any
+ * level streamed in or out.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UGroundHeightSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the ground height cache for the world of the given context object (nullptr if unavailable)
+	static UGroundHeightSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Ground height under Location, searched around ReferenceZ (e.g. the dropping character's feet). False if there is no ground.
+	bool GetGroundHeight(const FVector& Location, float ReferenceZ, float& OutGroundZ, const AActor* IgnoredActor = nullptr);
+
+	// Spread Count points on a spiral within Radius of Center, each placed on the ground (points without ground are skipped); returns how many were added
+	int32 GetScatterLocations(const FVector& Center, float Radius, int32 Count, TArray<FVector>& OutLocations, const AActor* IgnoredActor = nullptr);
+
+	// Fill the cells within Radius of Center with async traces, so later queries there are free
+	void PrefetchArea(const FVector& Center, float Radius);
+
+	// Drop every cached cell
+	UFUNCTION(BlueprintCallable, Category = "Ground Height")
+	void InvalidateAll();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Ground Height")
+	int32 GetNumCachedCells() const { return Cells.Num(); }
+
+protected:
+	// Width of a cache column
+	UPROPERTY(Config, EditAnywhere, Category = "Ground Height", meta = (ClampMin = "10.0"))
+	float CellSize = 200.0f;
+
+	// A cached sample only answers queries whose reference height is this close to it
+	UPROPERTY(Config, EditAnywhere, Category = "Ground Height", meta = (ClampMin = "0.0"))
+	float MaxStepHeight = 250.0f;
+
+	// Ground traces run from this far above the reference height...
+	UPROPERTY(Config, EditAnywhere, Category = "Ground Height", meta = (ClampMin = "0.0"))
+	float TraceUpDistance = 500.0f;
+
+	// ...to this far below it
+	UPROPERTY(Config, EditAnywhere, Category = "Ground Height", meta = (ClampMin = "0.0"))
+	float TraceDownDistance = 1000.0f;
+
+	// Reaching this many cells clears the cache
+	UPROPERTY(Config, EditAnywhere, Category = "Ground Height", meta = (ClampMin = "1"))
+	int32 MaxCachedCells = 16384;
+
+private:
+	struct FGroundCell
+	{
+		// Hit point and normal of the sample; the ground is the plane through them
+		FVector Point = FVector::ZeroVector;
+		FVector Normal = FVector::UpVector;
+
+		// Reference height of a sample that found no ground
+		float MissReferenceZ = 0.0f;
+		bool bHasGround = false;
+	};
+
+	FIntPoint GetCellKey(const FVector& Location) const;
+
+	// Cached answer for the column, if one is close enough to ReferenceZ
+	bool FindCachedHeight(const FIntPoint& Key, const FVector& Location, float ReferenceZ, bool& bOutHasGround, float& OutGroundZ) const;
+
+	void StoreSample(const FIntPoint& Key, const FGroundCell& Cell);
+
+	// Drop the cells overlapping a streamed level
+	void HandleLevelChanged(ULevel* Level, UWorld* World);
+
+	TMap<FIntPoint, FGroundCell> Cells;
+
+	// Columns with a prefetch trace in flight
+	TSet<FIntPoint> PendingCells;
+
+	// Bumped by every invalidation; in-flight prefetches of an older generation are discarded
+	uint32 CacheGeneration = 0;
+
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
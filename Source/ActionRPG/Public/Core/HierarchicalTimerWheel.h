@@ -0,0 +1,95 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Handle to a timer scheduled on an FHierarchicalTimerWheel.
+ */
+struct FTimerWheelHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Generation = 0; }
+};
+
+/**
+ * Hierarchical timer wheel (4 levels x 64 slots).
+ * Time is quantized into ticks of TickInterval seconds. Timers due within the next 64 ticks sit in
+ * level 0; later timers sit in coarser levels and cascade down as the wheel turns. Scheduling and
+ * cancelling are O(1), and advancing only touches timers that are expiring or cascading, so the
+ * per-frame cost does not grow with the number of pending timers.
+ *
+ * Each timer carries an opaque 64-bit payload that is handed back when it fires.
+ */
+class ACTIONRPG_API FHierarchicalTimerWheel
+{
+public:
+	explicit FHierarchicalTimerWheel(double InTickInterval = 1.0 / 60.0);
+
+	// Schedule a payload to fire after Delay seconds (at least one tick from now)
+	FTimerWheelHandle Schedule(double Delay, uint64 Payload);
+
+	// Cancel a pending timer. Returns false if it already fired or was cancelled.
+	bool Cancel(FTimerWheelHandle& Handle);
+
+	bool IsPending(const FTimerWheelHandle& Handle) const;
+
+	// Seconds until a pending timer fires (0 if not pending)
+	double GetTimeRemaining(const FTimerWheelHandle& Handle) const;
+
+	// Advance the wheel by DeltaTime and call OnExpired(Payload) for every timer that fires.
+	// Timers may be scheduled or cancelled from inside the callback.
+	void Advance(double DeltaTime, TFunctionRef<void(uint64 Payload)> OnExpired);
+
+	// Drop every pending timer
+	void Reset();
+
+	int32 GetNumPending() const { return NumPending; }
+	double GetTickInterval() const { return TickInterval; }
+
+private:
+	static constexpr int32 NumLevels = 4;
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+	static constexpr uint64 SlotMask = SlotsPerLevel - 1;
+
+	struct FTimerNode
+	{
+		uint64 ExpiryTick = 0;
+		uint64 Payload = 0;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+		int32 Bucket = INDEX_NONE;
+		uint32 Generation = 0;
+	};
+
+	// Place a node into the bucket matching its expiry (relative to CurrentTick)
+	void InsertNode(int32 NodeIndex);
+	void UnlinkNode(int32 NodeIndex);
+	void FreeNode(int32 NodeIndex);
+
+	// Detach a bucket's list and re-insert its timers one level down
+	void Cascade(int32 Level);
+
+	// Run a single tick
+	void Step(TFunctionRef<void(uint64 Payload)> OnExpired);
+
+	double TickInterval;
+	double Accumulator = 0.0;
+	uint64 CurrentTick = 0;
+	int32 NumPending = 0;
+
+	// Head node of each bucket (NumLevels * SlotsPerLevel)
+	TArray<int32> BucketHeads;
+
+	// Timer node pool
+	TArray<FTimerNode> Nodes;
+	TArray<int32> FreeNodes;
+
+	// Scratch list reused while firing a bucket
+	TArray<int32> ExpiringNodes;
+};
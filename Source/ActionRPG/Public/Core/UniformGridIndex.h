@@ -0,0 +1,283 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform spatial hash over the XY plane.
+ * Elements are bucketed into square cells of CellSize; each element keeps its cell and its
+ * index inside that cell, so moving within a cell is a single write and moving across cells is
+ * two swap-removes/appends. Only occupied cells are stored. Queries visit only the cells overlapping
+ * the query bounds and write results into a caller-provided buffer (no allocation).
+ *
+ * Height is ignored for bucketing and distance checks (top-down gameplay); Z is still stored.
+ */
+template<typename ElementType>
+class TUniformGridIndex
+{
+public:
+	explicit TUniformGridIndex(float InCellSize = 500.0f)
+		: CellSize(FMath::Max(InCellSize, 1.0f))
+		, InvCellSize(1.0f / CellSize)
+	{
+	}
+
+	void Reset()
+	{
+		Entries.Reset();
+		FreeIds.Reset();
+		Cells.Reset();
+		NumElements = 0;
+	}
+
+	// Changing the cell size re-buckets every element
+	void SetCellSize(float InCellSize)
+	{
+		CellSize = FMath::Max(InCellSize, 1.0f);
+		InvCellSize = 1.0f / CellSize;
+
+		Cells.Reset();
+		for (int32 Id = 0; Id < Entries.Num(); Id++)
+		{
+			if (Entries[Id].bInUse)
+			{
+				Entries[Id].Cell = GetCell(Entries[Id].Location);
+				AddToCell(Id);
+			}
+		}
+	}
+
+	float GetCellSize() const { return CellSize; }
+	int32 Num() const { return NumElements; }
+	int32 GetNumCells() const { return Cells.Num(); }
+
+	int32 Add(const ElementType& Element, const FVector& Location)
+	{
+		const int32 Id = FreeIds.Num() > 0 ? FreeIds.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+		FEntry& Entry = Entries[Id];
+		Entry.Element = Element;
+		Entry.Location = Location;
+		Entry.Cell = GetCell(Location);
+		Entry.bInUse = true;
+		AddToCell(Id);
+
+		NumElements++;
+		return Id;
+	}
+
+	void Update(int32 Id, const FVector& Location)
+	{
+		if (!IsValidId(Id))
+		{
+			return;
+		}
+
+		FEntry& Entry = Entries[Id];
+		Entry.Location = Location;
+
+		const FIntPoint NewCell = GetCell(Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Id);
+			Entries[Id].Cell = NewCell;
+			AddToCell(Id);
+		}
+	}
+
+	void Remove(int32 Id)
+	{
+		if (!IsValidId(Id))
+		{
+			return;
+		}
+
+		RemoveFromCell(Id);
+
+		FEntry& Entry = Entries[Id];
+		Entry = FEntry();
+		FreeIds.Add(Id);
+		NumElements--;
+	}
+
+	bool IsValidId(int32 Id) const { return Entries.IsValidIndex(Id) && Entries[Id].bInUse; }
+	const ElementType& GetElement(int32 Id) const { return Entries[Id].Element; }
+	const FVector& GetLocation(int32 Id) const { return Entries[Id].Location; }
+
+	// Visit every element in the cells overlapping an XY box. Visitor(Element, Location) returns false to stop.
+	template<typename VisitorType>
+	void ForEachInBox(const FVector2D& Min, const FVector2D& Max, VisitorType&& Visitor) const
+	{
+		const FIntPoint MinCell = GetCell(FVector(Min, 0.0));
+		const FIntPoint MaxCell = GetCell(FVector(Max, 0.0));
+
+		for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; CellY++)
+		{
+			for (int32 CellX = MinCell.X; CellX <= MaxCell.X; CellX++)
+			{
+				const TArray<int32>* CellIds = Cells.Find(FIntPoint(CellX, CellY));
+				if (!CellIds)
+				{
+					continue;
+				}
+
+				for (const int32 Id : *CellIds)
+				{
+					const FEntry& Entry = Entries[Id];
+					if (!Visitor(Entry.Element, Entry.Location))
+					{
+						return;
+					}
+				}
+			}
+		}
+	}
+
+	// Elements within Radius of Center that pass Filter(Element). Returns the number written to OutElements.
+	template<typename FilterType>
+	int32 QueryRadius(const FVector& Center, float Radius, TArrayView<ElementType> OutElements, FilterType&& Filter) const
+	{
+		int32 NumFound = 0;
+		if (OutElements.Num() == 0 || Radius < 0.0f)
+		{
+			return NumFound;
+		}
+
+		const FVector2D Center2D(Center);
+		const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+
+		ForEachInBox(Center2D - FVector2D(Radius), Center2D + FVector2D(Radius),
+			[&](const ElementType& Element, const FVector& Location)
+			{
+				if (FVector2D::DistSquared(Center2D, FVector2D(Location)) <= RadiusSq && Filter(Element))
+				{
+					OutElements[NumFound++] = Element;
+				}
+				return NumFound < OutElements.Num();
+			});
+
+		return NumFound;
+	}
+
+	// Elements within Range of Origin and HalfAngleDegrees of Direction (XY). Returns the number written.
+	template<typename FilterType>
+	int32 QueryCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees, TArrayView<ElementType> OutElements, FilterType&& Filter) const
+	{
+		int32 NumFound = 0;
+		const FVector2D Forward = FVector2D(Direction).GetSafeNormal();
+		if (OutElements.Num() == 0 || Range < 0.0f || Forward.IsZero())
+		{
+			return NumFound;
+		}
+
+		const FVector2D Origin2D(Origin);
+		const double RangeSq = FMath::Square(static_cast<double>(Range));
+		const double CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+
+		ForEachInBox(Origin2D - FVector2D(Range), Origin2D + FVector2D(Range),
+			[&](const ElementType& Element, const FVector& Location)
+			{
+				const FVector2D ToElement = FVector2D(Location) - Origin2D;
+				const double DistSq = ToElement.SizeSquared();
+				if (DistSq <= RangeSq)
+				{
+					// Elements on the origin count as inside the cone
+					const bool bInAngle = DistSq < UE_KINDA_SMALL_NUMBER
+						|| FVector2D::DotProduct(ToElement, Forward) >= CosHalfAngle * FMath::Sqrt(DistSq);
+					if (bInAngle && Filter(Element))
+					{
+						OutElements[NumFound++] = Element;
+					}
+				}
+				return NumFound < OutElements.Num();
+			});
+
+		return NumFound;
+	}
+
+	// Elements within HalfWidth of the segment Start-End (XY). Returns the number written.
+	template<typename FilterType>
+	int32 QueryLine(const FVector& Start, const FVector& End, float HalfWidth, TArrayView<ElementType> OutElements, FilterType&& Filter) const
+	{
+		int32 NumFound = 0;
+		if (OutElements.Num() == 0 || HalfWidth < 0.0f)
+		{
+			return NumFound;
+		}
+
+		const FVector2D Start2D(Start);
+		const FVector2D End2D(End);
+		const FVector2D Segment = End2D - Start2D;
+		const double SegmentLengthSq = Segment.SizeSquared();
+		const double HalfWidthSq = FMath::Square(static_cast<double>(HalfWidth));
+
+		const FVector2D BoxMin = FVector2D(FMath::Min(Start2D.X, End2D.X), FMath::Min(Start2D.Y, End2D.Y)) - FVector2D(HalfWidth);
+		const FVector2D BoxMax = FVector2D(FMath::Max(Start2D.X, End2D.X), FMath::Max(Start2D.Y, End2D.Y)) + FVector2D(HalfWidth);
+
+		ForEachInBox(BoxMin, BoxMax,
+			[&](const ElementType& Element, const FVector& Location)
+			{
+				const FVector2D Point(Location);
+				const double T = SegmentLengthSq > 0.0
+					? FMath::Clamp(FVector2D::DotProduct(Point - Start2D, Segment) / SegmentLengthSq, 0.0, 1.0)
+					: 0.0;
+				if (FVector2D::DistSquared(Point, Start2D + Segment * T) <= HalfWidthSq && Filter(Element))
+				{
+					OutElements[NumFound++] = Element;
+				}
+				return NumFound < OutElements.Num();
+			});
+
+		return NumFound;
+	}
+
+private:
+	struct FEntry
+	{
+		ElementType Element = ElementType();
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		int32 IndexInCell = INDEX_NONE;
+		bool bInUse = false;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X * InvCellSize), FMath::FloorToInt32(Location.Y * InvCellSize));
+	}
+
+	void AddToCell(int32 Id)
+	{
+		TArray<int32>& CellIds = Cells.FindOrAdd(Entries[Id].Cell);
+		Entries[Id].IndexInCell = CellIds.Add(Id);
+	}
+
+	void RemoveFromCell(int32 Id)
+	{
+		FEntry& Entry = Entries[Id];
+		if (TArray<int32>* CellIds = Cells.Find(Entry.Cell))
+		{
+			const int32 IndexInCell = Entry.IndexInCell;
+			CellIds->RemoveAtSwap(IndexInCell, EAllowShrinking::No);
+			if (CellIds->IsValidIndex(IndexInCell))
+			{
+				Entries[(*CellIds)[IndexInCell]].IndexInCell = IndexInCell;
+			}
+			else if (CellIds->Num() == 0)
+			{
+				// Drop empty cells, so the map only holds occupied cells and queries don't probe dead ones
+				Cells.Remove(Entry.Cell);
+			}
+		}
+		Entry.IndexInCell = INDEX_NONE;
+	}
+
+	float CellSize;
+	float InvCellSize;
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeIds;
+	TMap<FIntPoint, TArray<int32>> Cells;
+	int32 NumElements = 0;
+};
@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ActionRPGDataSubsystem.generated.h"
+
+class UItemDatabase;
+class USkillDatabase;
+
+/**
+ * Startup timeline recorded by the data subsystem.
+ * All times are seconds since the subsystem was initialized (-1 until the milestone is reached).
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FActionRPGStartupTimeline
+{
+	GENERATED_BODY()
+
+	// Seconds from process start to game instance init
+	UPROPERTY(BlueprintReadOnly, Category = "Startup")
+	float GameInstanceInitTime = -1.0f;
+
+	// First engine frame finished (map loaded and ticking)
+	UPROPERTY(BlueprintReadOnly, Category = "Startup")
+	float FirstFrameTime = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Startup")
+	float ItemDataReadyTime = -1.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Startup")
+	float SkillDataReadyTime = -1.0f;
+
+	// All databases loaded
+	UPROPERTY(BlueprintReadOnly, Category = "Startup")
+	float DataReadyTime = -1.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnActionRPGDataReady);
+
+/**
+ * Hosts the Item and Skill databases for the lifetime of the game instance.
+ * Both databases start loading asynchronously as soon as the game instance initializes,
+ * in parallel with each other and with the first map load. Lookups made before the data
+ * is ready simply miss - nothing on a gameplay path ever blocks on a load.
+ */
+UCLASS()
+class ACTIONRPG_API UActionRPGDataSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the subsystem for the game instance of the given context object (nullptr if unavailable)
+	static UActionRPGDataSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Data")
+	UItemDatabase* GetItemDatabase() const { return ItemDatabase; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Data")
+	USkillDatabase* GetSkillDatabase() const { return SkillDatabase; }
+
+	// True once every database has finished loading
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Data")
+	bool IsDataReady() const { return PendingDatabases == 0; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Data")
+	FActionRPGStartupTimeline GetStartupTimeline() const { return Timeline; }
+
+	// Fired once when every database has finished loading
+	UPROPERTY(BlueprintAssignable, Category = "Data")
+	FOnActionRPGDataReady OnDataReady;
+
+private:
+	void HandleItemDatabaseLoaded();
+	void HandleSkillDatabaseLoaded();
+	void HandleDatabaseLoaded();
+	void HandleEndFrame();
+	void ReportTimelineIfComplete();
+
+	float GetSecondsSinceInit() const;
+
+	UPROPERTY()
+	TObjectPtr<UItemDatabase> ItemDatabase;
+
+	UPROPERTY()
+	TObjectPtr<USkillDatabase> SkillDatabase;
+
+	FActionRPGStartupTimeline Timeline;
+
+	double InitTime = 0.0;
+	int32 PendingDatabases = 0;
+	bool bTimelineReported = false;
+	FDelegateHandle EndFrameHandle;
+};
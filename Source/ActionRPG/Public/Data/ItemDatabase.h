@@ -5,14 +5,56 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Items/Core/ItemTypes.h"
+#include "Items/Core/ItemDataAsset.h"
+#include "Items/Effects/ItemEffectTable.h"
+#include "Data/PrimaryAssetRegistry.h"
 #include "ItemDatabase.generated.h"
 
-class UItemDataAsset;
+/** Registry traits for Item Data Assets (primary asset type "Item", keyed by ItemID). */
+struct FItemAssetTraits
+{
+	static FPrimaryAssetType GetAssetType() { return FPrimaryAssetType("Item"); }
+	static FName GetKey(const UItemDataAsset& ItemData) { return ItemData.ItemID; }
+	static int32 GetDenseIndex(const UItemDataAsset& ItemData) { return ItemData.RuntimeIndex; }
+	static void SetDenseIndex(UItemDataAsset& ItemData, int32 DenseIndex) { ItemData.RuntimeIndex = DenseIndex; }
+	static const TCHAR* GetLogName() { return TEXT("ItemDatabase"); }
+};
+
+// Secondary indexes
+struct FItemIndexByType
+{
+	using KeyType = EItemType;
+	static KeyType GetKey(const UItemDataAsset& ItemData) { return ItemData.Type; }
+};
+
+struct FItemIndexByRarity
+{
+	using KeyType = EItemRarity;
+	static KeyType GetKey(const UItemDataAsset& ItemData) { return ItemData.Rarity; }
+};
+
+using FItemAssetRegistry = TPrimaryAssetRegistry<UItemDataAsset, FItemAssetTraits, TPrimaryAssetIndexList<FItemIndexByType, FItemIndexByRarity>>;
+
+struct FAssetData;
+
+// Kind of change reported by UItemDatabase::OnItemDatabaseChanged
+UENUM(BlueprintType)
+enum class EItemDatabaseChange : uint8
+{
+	Added		UMETA(DisplayName = "Added"),
+	Updated		UMETA(DisplayName = "Updated"),
+	Removed		UMETA(DisplayName = "Removed"),
+	Replaced	UMETA(DisplayName = "Replaced")	// A different asset took over an existing ID (and its RuntimeIndex)
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnItemDatabaseChanged, EItemDatabaseChange, ChangeType, FName, ItemID, int32, RuntimeIndex);
 
 /**
- * Singleton database for managing Item Data Assets.
+ * Database for managing Item Data Assets, owned by UActionRPGDataSubsystem (one per game instance).
  * Provides lookup and retrieval of item data assets by ID, type, or rarity.
- * Automatically loads all item data assets via Asset Manager on initialization.
+ * Loads all item data assets asynchronously via Asset Manager when the game instance starts.
+ * Storage, loading and indexing are provided by FItemAssetRegistry.
+ * Item assets added, removed or edited while running are patched in place (hot reload).
  */
 UCLASS()
 class ACTIONRPG_API UItemDatabase : public UObject
@@ -20,12 +62,29 @@ class ACTIONRPG_API UItemDatabase : public UObject
 	GENERATED_BODY()
 
 public:
-	// Singleton accessor
+	// Accessor - the database of the context object's game instance (nullptr if there is none)
+	UFUNCTION(BlueprintCallable, Category = "Item Database", meta = (WorldContext = "WorldContextObject"))
+	static UItemDatabase* Get(const UObject* WorldContextObject);
+
+	// UObject interface - keeps registered assets referenced
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+	virtual void BeginDestroy() override;
+
+	// Start loading all item data assets asynchronously. OnLoaded fires once every asset is registered.
+	void BeginLoad(FSimpleDelegate OnLoaded);
+
+	// True once the initial load has completed (lookups miss until then)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Item Database")
+	bool IsReady() const { return bIsReady; }
+
+	// Hot reload - re-read a single item asset and patch its entry, secondary indexes and effects.
+	// Dense indexes of all other items are untouched. Returns true if the item is registered afterwards.
 	UFUNCTION(BlueprintCallable, Category = "Item Database")
-	static UItemDatabase* Get();
+	bool RefreshItem(UItemDataAsset* ItemData);
 
-	// Initialize database - loads all item data assets
-	void Initialize();
+	// Fired for every item added, updated, removed or replaced after initialization
+	UPROPERTY(BlueprintAssignable, Category = "Item Database")
+	FOnItemDatabaseChanged OnItemDatabaseChanged;
 
 	// Lookup methods
 	UFUNCTION(BlueprintCallable, Category = "Item Database")
@@ -34,6 +93,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Item Database")
 	TArray<UItemDataAsset*> GetAllItemDataAssets() const;
 
+	// Lookup by dense RuntimeIndex (assigned at registration)
+	UItemDataAsset* GetItemDataAssetByIndex(int32 ItemIndex) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Item Database")
 	TArray<UItemDataAsset*> GetItemsByType(EItemType ItemType) const;
 
@@ -49,15 +111,41 @@ public:
 	void PrintAllItems() const;
 
 	// Create item instance from data asset
-	UFUNCTION(BlueprintCallable, Category = "Item Database")
-	class UItemBase* CreateItem(const FName& ItemID, int32 Quantity = 1) const;
+	// With a world context the instance comes from that world's UItemInstancePool (release it back when done)
+	UFUNCTION(BlueprintCallable, Category = "Item Database", meta = (WorldContext = "WorldContextObject"))
+	class UItemBase* CreateItem(const FName& ItemID, int32 Quantity = 1, const UObject* WorldContextObject = nullptr) const;
 
-protected:
-	// Registry of all item data assets
-	UPROPERTY()
-	TMap<FName, TObjectPtr<UItemDataAsset>> ItemRegistry;
+	// Item effects (compiled once at initialization, dispatched by RuntimeIndex)
+	const FItemEffectTable& GetEffectTable() const { return EffectTable; }
 
-private:
-	static UItemDatabase* Instance;
+	// Underlying asset registry (dense indexes, secondary indexes)
+	const FItemAssetRegistry& GetRegistry() const { return Registry; }
+
+protected:
+	// Registry of all item data assets (RuntimeIndex is the registry's dense index)
+	FItemAssetRegistry Registry;
+
+	// Compiled item effects, keyed by RuntimeIndex
+	FItemEffectTable EffectTable;
+
+	// Hot reload
+	void RegisterHotReloadHandlers();
+	void UnregisterHotReloadHandlers();
+	void RemoveItemEntry(int32 ItemIndex);
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetUpdated(const FAssetData& AssetData);
+#if WITH_EDITOR
+	void HandleObjectPropertyChanged(UObject* Object, FPropertyChangedEvent& PropertyChangedEvent);
+#endif
+
+	FDelegateHandle AssetAddedHandle;
+	FDelegateHandle AssetRemovedHandle;
+	FDelegateHandle AssetUpdatedHandle;
+	FDelegateHandle ObjectPropertyChangedHandle;
+
+	void HandleLoadComplete(FSimpleDelegate OnLoaded);
+
+	bool bIsReady = false;
 };
 
@@ -0,0 +1,531 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+/**
+ * Compile-time list of secondary indexes for a TPrimaryAssetRegistry.
+ * Each index type provides:
+ *   using KeyType = ...;                            // hashable key (enum, FName, ...)
+ *   static KeyType GetKey(const TAsset& Asset);     // key the asset is filed under
+ */
+template <typename... TIndexes>
+struct TPrimaryAssetIndexList
+{
+};
+
+/**
+ * Bucketed lookup for one secondary index: Key -> dense indexes of matching assets.
+ * The key each asset was filed under is snapshotted so the entry can be removed
+ * even if the asset's property has changed since (e.g. edited in the editor).
+ */
+template <typename TAsset, typename TIndex>
+struct TPrimaryAssetSecondaryIndex
+{
+	using KeyType = typename TIndex::KeyType;
+
+	TMap<KeyType, TArray<int32>> Buckets;
+	TArray<TOptional<KeyType>> KeySnapshots;
+
+	void Reset()
+	{
+		Buckets.Reset();
+		KeySnapshots.Reset();
+	}
+
+	void Add(int32 DenseIndex, const TAsset& Asset)
+	{
+		if (!KeySnapshots.IsValidIndex(DenseIndex))
+		{
+			KeySnapshots.SetNum(DenseIndex + 1);
+		}
+
+		const KeyType Key = TIndex::GetKey(Asset);
+		Buckets.FindOrAdd(Key).AddUnique(DenseIndex);
+		KeySnapshots[DenseIndex] = Key;
+	}
+
+	void Remove(int32 DenseIndex)
+	{
+		if (!KeySnapshots.IsValidIndex(DenseIndex) || !KeySnapshots[DenseIndex].IsSet())
+		{
+			return;
+		}
+
+		const KeyType Key = KeySnapshots[DenseIndex].GetValue();
+		if (TArray<int32>* Bucket = Buckets.Find(Key))
+		{
+			Bucket->Remove(DenseIndex);
+			if (Bucket->Num() == 0)
+			{
+				Buckets.Remove(Key);
+			}
+		}
+		KeySnapshots[DenseIndex].Reset();
+	}
+
+	TConstArrayView<int32> Find(const KeyType& Key) const
+	{
+		const TArray<int32>* Bucket = Buckets.Find(Key);
+		return Bucket ? TConstArrayView<int32>(*Bucket) : TConstArrayView<int32>();
+	}
+};
+
+template <typename TAsset, typename TKeyTraits, typename TIndexList = TPrimaryAssetIndexList<>>
+class TPrimaryAssetRegistry;
+
+/**
+ * Registry of primary data assets of one Asset Manager type, shared by the data databases
+ * (items, skills, ...).
+ *
+ * - Assets are loaded asynchronously through the Asset Manager in batched requests (LoadAsync).
+ * - Every registered asset gets a dense index. A load registers its assets in FPrimaryAssetId
+ *   name order once every batch is in, not in batch completion order, so the same asset set always
+ *   gets the same indexes. This matters because the index is also written onto the asset itself
+ *   (SetDenseIndex), which is shared by every registry that loads it (e.g. several PIE instances). Removed entries leave a hole that is never reused
+ *   (until Reset), so an index handed out keeps naming the same entry - or nothing - and never
+ *   silently resolves to a different asset. Only hot reload removes entries, so holes are rare.
+ * - Dense indexes are process-local: they depend on which assets this process loaded and on hot
+ *   reloads since. Never save or replicate one - send the key (FName) across the process boundary
+ *   and resolve it with FindIndex on the other side.
+ * - Secondary indexes are declared at compile time through TPrimaryAssetIndexList and kept
+ *   up to date on register/unregister, replacing linear "filter by X" scans.
+ * - Single entries can be patched in place (Refresh/Unregister) for hot reload.
+ *
+ * TKeyTraits provides:
+ *   static FPrimaryAssetType GetAssetType();
+ *   static FName GetKey(const TAsset& Asset);
+ *   static int32 GetDenseIndex(const TAsset& Asset);
+ *   static void SetDenseIndex(TAsset& Asset, int32 DenseIndex);
+ *   static const TCHAR* GetLogName();
+ *
+ * The owning UObject must forward AddReferencedObjects so registered assets are kept alive.
+ */
+template <typename TAsset, typename TKeyTraits, typename... TIndexes>
+class TPrimaryAssetRegistry<TAsset, TKeyTraits, TPrimaryAssetIndexList<TIndexes...>>
+{
+public:
+	using FOnLoadComplete = TFunction<void()>;
+
+	TPrimaryAssetRegistry() = default;
+	TPrimaryAssetRegistry(const TPrimaryAssetRegistry&) = delete;
+	TPrimaryAssetRegistry& operator=(const TPrimaryAssetRegistry&) = delete;
+
+	~TPrimaryAssetRegistry()
+	{
+		CancelPendingLoads();
+	}
+
+	// Clear all entries and indexes (cancels any pending async load).
+	// The assets keep their dense index: another registry (PIE instance) may still have them registered
+	// under it, and a reload assigns the same index again.
+	void Reset()
+	{
+		CancelPendingLoads();
+
+		Assets.Reset();
+		Keys.Reset();
+		KeyToIndex.Reset();
+		(GetIndexStorage<TIndexes>().Reset(), ...);
+	}
+
+	// Load every primary asset of this type asynchronously in batches of BatchSize.
+	// Once all batches are done, the assets are registered in name order and OnComplete runs.
+	void LoadAsync(FOnLoadComplete OnComplete, int32 BatchSize = 32)
+	{
+		CancelPendingLoads();
+
+		TArray<FPrimaryAssetId> AssetIds;
+		UAssetManager* AssetManager = GatherAssetIds(AssetIds);
+		if (!AssetManager || AssetIds.Num() == 0)
+		{
+			if (OnComplete)
+			{
+				OnComplete();
+			}
+			return;
+		}
+
+		// Registration order decides the dense indexes - make it independent of the asset scan and load timing
+		AssetIds.Sort([](const FPrimaryAssetId& A, const FPrimaryAssetId& B)
+		{
+			return A.PrimaryAssetName.LexicalLess(B.PrimaryAssetName);
+		});
+		PendingAssetIds = AssetIds;
+
+		BatchSize = FMath::Max(1, BatchSize);
+		const int32 NumBatches = FMath::DivideAndRoundUp(AssetIds.Num(), BatchSize);
+
+		PendingOnComplete = MoveTemp(OnComplete);
+		PendingBatches = NumBatches;
+		BatchCompleted.Init(false, NumBatches);
+		const uint32 Generation = LoadGeneration;
+
+		UE_LOG(LogTemp, Log, TEXT("%s: Loading %d assets asynchronously in %d batches"), TKeyTraits::GetLogName(), AssetIds.Num(), NumBatches);
+
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
+		{
+			const int32 First = BatchIndex * BatchSize;
+			TArray<FPrimaryAssetId> BatchIds(AssetIds.GetData() + First, FMath::Min(BatchSize, AssetIds.Num() - First));
+
+			TSharedPtr<FStreamableHandle> Handle = AssetManager->LoadPrimaryAssets(BatchIds, TArray<FName>(),
+				FStreamableDelegate::CreateLambda([this, BatchIndex, Generation]()
+				{
+					if (Generation == LoadGeneration)
+					{
+						OnBatchLoaded(BatchIndex);
+					}
+				}));
+
+			if (Handle.IsValid())
+			{
+				PendingHandles.Add(Handle);
+			}
+			else if (Generation == LoadGeneration)
+			{
+				// Nothing to stream (already resident) - done straight away
+				OnBatchLoaded(BatchIndex);
+			}
+		}
+	}
+
+	bool IsLoading() const { return PendingBatches > 0; }
+
+	// Cancel outstanding async batches; already-registered assets are kept
+	void CancelPendingLoads()
+	{
+		LoadGeneration++;
+		for (const TSharedPtr<FStreamableHandle>& Handle : PendingHandles)
+		{
+			if (Handle.IsValid())
+			{
+				Handle->CancelHandle();
+			}
+		}
+		PendingHandles.Reset();
+		PendingBatches = 0;
+		BatchCompleted.Reset();
+		PendingAssetIds.Reset();
+		PendingOnComplete = nullptr;
+	}
+
+	// Register an asset under its key; an asset already under that key is replaced and the index kept.
+	// Returns its dense index, or INDEX_NONE if the key is empty.
+	int32 Register(TAsset& Asset)
+	{
+		const FName Key = TKeyTraits::GetKey(Asset);
+		if (Key == NAME_None)
+		{
+			return INDEX_NONE;
+		}
+
+		int32 DenseIndex = INDEX_NONE;
+		if (const int32* ExistingIndex = KeyToIndex.Find(Key))
+		{
+			// Same key registered again - keep the dense index, refresh indexes
+			DenseIndex = *ExistingIndex;
+			(GetIndexStorage<TIndexes>().Remove(DenseIndex), ...);
+			TAsset* Replaced = Assets[DenseIndex];
+			if (Replaced && Replaced != &Asset)
+			{
+				TKeyTraits::SetDenseIndex(*Replaced, INDEX_NONE);
+			}
+			Assets[DenseIndex] = &Asset;
+		}
+		else
+		{
+			DenseIndex = Assets.Add(&Asset);
+			Keys.Add(NAME_None);
+		}
+
+		KeyToIndex.Add(Key, DenseIndex);
+		Keys[DenseIndex] = Key;
+		TKeyTraits::SetDenseIndex(Asset, DenseIndex);
+		(GetIndexStorage<TIndexes>().Add(DenseIndex, Asset), ...);
+		return DenseIndex;
+	}
+
+	// Remove an entry by key. Its dense index is left empty, never reused. Returns the freed index or INDEX_NONE.
+	int32 Unregister(FName Key)
+	{
+		int32 DenseIndex = INDEX_NONE;
+		if (!KeyToIndex.RemoveAndCopyValue(Key, DenseIndex))
+		{
+			return INDEX_NONE;
+		}
+
+		(GetIndexStorage<TIndexes>().Remove(DenseIndex), ...);
+		if (TAsset* Asset = Assets[DenseIndex])
+		{
+			TKeyTraits::SetDenseIndex(*Asset, INDEX_NONE);
+		}
+		Assets[DenseIndex] = nullptr;
+		Keys[DenseIndex] = NAME_None;
+		return DenseIndex;
+	}
+
+	// Dense index of a registered asset instance, or INDEX_NONE if this instance is not registered
+	int32 IndexOf(const TAsset& Asset) const
+	{
+		const int32 DenseIndex = TKeyTraits::GetDenseIndex(Asset);
+		return (Assets.IsValidIndex(DenseIndex) && Assets[DenseIndex] == &Asset) ? DenseIndex : INDEX_NONE;
+	}
+
+	// Key an entry is currently registered under (may differ from the asset's key if it was edited since)
+	FName GetKeyAt(int32 DenseIndex) const
+	{
+		return Keys.IsValidIndex(DenseIndex) ? Keys[DenseIndex] : NAME_None;
+	}
+
+	// Patch a single asset in place after it was edited or reloaded.
+	// Keeps its dense index, follows key renames and re-files secondary indexes.
+	// Returns the dense index, or INDEX_NONE if the asset is (now) unregistered.
+	int32 Refresh(TAsset& Asset)
+	{
+		const int32 DenseIndex = IndexOf(Asset);
+		if (DenseIndex == INDEX_NONE)
+		{
+			return Register(Asset);
+		}
+
+		const FName OldKey = Keys[DenseIndex];
+		const FName NewKey = TKeyTraits::GetKey(Asset);
+		if (NewKey == NAME_None)
+		{
+			Unregister(OldKey);
+			return INDEX_NONE;
+		}
+
+		if (NewKey != OldKey)
+		{
+			// Renamed onto another entry's key - the edited asset wins
+			if (KeyToIndex.Contains(NewKey))
+			{
+				Unregister(NewKey);
+			}
+
+			KeyToIndex.Remove(OldKey);
+			KeyToIndex.Add(NewKey, DenseIndex);
+			Keys[DenseIndex] = NewKey;
+		}
+
+		Reindex(DenseIndex);
+		return DenseIndex;
+	}
+
+	// Re-file an entry in the secondary indexes after its indexed properties changed
+	void Reindex(int32 DenseIndex)
+	{
+		if (TAsset* Asset = GetByIndex(DenseIndex))
+		{
+			(GetIndexStorage<TIndexes>().Remove(DenseIndex), ...);
+			(GetIndexStorage<TIndexes>().Add(DenseIndex, *Asset), ...);
+		}
+	}
+
+	// Lookup
+	TAsset* Find(FName Key) const
+	{
+		const int32* DenseIndex = KeyToIndex.Find(Key);
+		return DenseIndex ? Assets[*DenseIndex].Get() : nullptr;
+	}
+
+	int32 FindIndex(FName Key) const
+	{
+		const int32* DenseIndex = KeyToIndex.Find(Key);
+		return DenseIndex ? *DenseIndex : INDEX_NONE;
+	}
+
+	TAsset* GetByIndex(int32 DenseIndex) const
+	{
+		return Assets.IsValidIndex(DenseIndex) ? Assets[DenseIndex].Get() : nullptr;
+	}
+
+	// Number of registered entries (excludes empty slots)
+	int32 Num() const { return KeyToIndex.Num(); }
+
+	// Size of the dense index space (including empty slots)
+	int32 GetIndexCapacity() const { return Assets.Num(); }
+
+	// Dense indexes filed under Key in the secondary index TIndex
+	template <typename TIndex>
+	TConstArrayView<int32> FindIndexesBy(const typename TIndex::KeyType& Key) const
+	{
+		return GetIndexStorage<TIndex>().Find(Key);
+	}
+
+	// Assets filed under Key in the secondary index TIndex
+	template <typename TIndex>
+	TArray<TAsset*> FindBy(const typename TIndex::KeyType& Key) const
+	{
+		const TConstArrayView<int32> DenseIndexes = FindIndexesBy<TIndex>(Key);
+
+		TArray<TAsset*> Result;
+		Result.Reserve(DenseIndexes.Num());
+		for (const int32 DenseIndex : DenseIndexes)
+		{
+			Result.Add(Assets[DenseIndex]);
+		}
+		return Result;
+	}
+
+	// Visit every registered asset in dense index order
+	template <typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (const TObjectPtr<TAsset>& Asset : Assets)
+		{
+			if (Asset)
+			{
+				Func(*Asset);
+			}
+		}
+	}
+
+	TArray<TAsset*> GetAll() const
+	{
+		TArray<TAsset*> Result;
+		Result.Reserve(Num());
+		ForEach([&Result](TAsset& Asset) { Result.Add(&Asset); });
+		return Result;
+	}
+
+	TArray<FName> GetAllKeys() const
+	{
+		TArray<FName> Result;
+		Result.Reserve(Num());
+		ForEach([&Result](const TAsset& Asset) { Result.Add(TKeyTraits::GetKey(Asset)); });
+		return Result;
+	}
+
+	// Forward from the owning UObject's AddReferencedObjects
+	void AddReferencedObjects(FReferenceCollector& Collector)
+	{
+		Collector.AddReferencedObjects(Assets);
+	}
+
+private:
+	template <typename TIndex>
+	TPrimaryAssetSecondaryIndex<TAsset, TIndex>& GetIndexStorage()
+	{
+		return static_cast<TPrimaryAssetSecondaryIndex<TAsset, TIndex>&>(Indexes);
+	}
+
+	template <typename TIndex>
+	const TPrimaryAssetSecondaryIndex<TAsset, TIndex>& GetIndexStorage() const
+	{
+		return static_cast<const TPrimaryAssetSecondaryIndex<TAsset, TIndex>&>(Indexes);
+	}
+
+	UAssetManager* GatherAssetIds(TArray<FPrimaryAssetId>& OutAssetIds) const
+	{
+		UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+		if (!AssetManager)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: AssetManager is not initialized!"), TKeyTraits::GetLogName());
+			return nullptr;
+		}
+
+		const FPrimaryAssetType AssetType = TKeyTraits::GetAssetType();
+		AssetManager->GetPrimaryAssetIdList(AssetType, OutAssetIds);
+
+		UE_LOG(LogTemp, Log, TEXT("%s: Found %d '%s' assets to process"), TKeyTraits::GetLogName(), OutAssetIds.Num(), *AssetType.ToString());
+
+		if (OutAssetIds.Num() == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: No assets found! Check that Primary Asset Type '%s' is configured in the Asset Manager settings and its directory is in the scan list."),
+				TKeyTraits::GetLogName(), *AssetType.ToString());
+		}
+
+		return AssetManager;
+	}
+
+	int32 RegisterLoadedAssets(UAssetManager& AssetManager, TConstArrayView<FPrimaryAssetId> AssetIds)
+	{
+		int32 NumRegistered = 0;
+		for (const FPrimaryAssetId& AssetId : AssetIds)
+		{
+			UObject* AssetObject = AssetManager.GetPrimaryAssetObject(AssetId);
+			if (!AssetObject)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: Failed to get asset object: %s"), TKeyTraits::GetLogName(), *AssetId.ToString());
+				continue;
+			}
+
+			TAsset* Asset = Cast<TAsset>(AssetObject);
+			if (!Asset)
+			{
+				UE_LOG(LogTemp, Error, TEXT("%s: Asset %s is a %s, expected %s. It was probably created as a Blueprint Class or plain Data Asset - recreate it as a '%s' Data Asset."),
+					TKeyTraits::GetLogName(), *AssetId.ToString(), *AssetObject->GetClass()->GetName(),
+					*TAsset::StaticClass()->GetName(), *TAsset::StaticClass()->GetName());
+				continue;
+			}
+
+			if (Register(*Asset) == INDEX_NONE)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: Data Asset has an empty ID: %s"), TKeyTraits::GetLogName(), *AssetId.ToString());
+				continue;
+			}
+
+			NumRegistered++;
+		}
+		return NumRegistered;
+	}
+
+	void OnBatchLoaded(int32 BatchIndex)
+	{
+		if (!BatchCompleted.IsValidIndex(BatchIndex) || BatchCompleted[BatchIndex])
+		{
+			return;
+		}
+		BatchCompleted[BatchIndex] = true;
+
+		if (--PendingBatches == 0)
+		{
+			// Every batch is resident - register in the sorted order, whichever batch finished first
+			if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+			{
+				RegisterLoadedAssets(*AssetManager, PendingAssetIds);
+			}
+			PendingAssetIds.Reset();
+
+			UE_LOG(LogTemp, Log, TEXT("%s: Async load complete. Registered %d assets."), TKeyTraits::GetLogName(), Num());
+
+			PendingHandles.Reset();
+			BatchCompleted.Reset();
+			FOnLoadComplete OnComplete = MoveTemp(PendingOnComplete);
+			PendingOnComplete = nullptr;
+			if (OnComplete)
+			{
+				OnComplete();
+			}
+		}
+	}
+
+	struct FIndexes : TPrimaryAssetSecondaryIndex<TAsset, TIndexes>...
+	{
+	};
+
+	// Dense storage, indexed by dense index (nullptr for removed entries)
+	TArray<TObjectPtr<TAsset>> Assets;
+
+	// Key each dense index is registered under (NAME_None for removed entries)
+	TArray<FName> Keys;
+
+	// Primary key -> dense index
+	TMap<FName, int32> KeyToIndex;
+
+	// Secondary indexes
+	FIndexes Indexes;
+
+	// Async load state
+	TArray<TSharedPtr<FStreamableHandle>> PendingHandles;
+	TBitArray<> BatchCompleted;
+	TArray<FPrimaryAssetId> PendingAssetIds;
+	FOnLoadComplete PendingOnComplete;
+	int32 PendingBatches = 0;
+	uint32 LoadGeneration = 0;
+};
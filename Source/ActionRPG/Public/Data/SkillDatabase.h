@@ -5,14 +5,41 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Skills/Core/SkillTypes.h"
+#include "Skills/Core/SkillDataAsset.h"
+#include "Skills/Core/SkillSpec.h"
+#include "Data/PrimaryAssetRegistry.h"
 #include "SkillDatabase.generated.h"
 
-class USkillDataAsset;
+/** Registry traits for Skill Data Assets (primary asset type "Skill", keyed by SkillID). */
+struct FSkillAssetTraits
+{
+	static FPrimaryAssetType GetAssetType() { return FPrimaryAssetType("Skill"); }
+	static FName GetKey(const USkillDataAsset& SkillData) { return SkillData.SkillID; }
+	static int32 GetDenseIndex(const USkillDataAsset& SkillData) { return SkillData.RuntimeIndex; }
+	static void SetDenseIndex(USkillDataAsset& SkillData, int32 DenseIndex) { SkillData.RuntimeIndex = DenseIndex; }
+	static const TCHAR* GetLogName() { return TEXT("SkillDatabase"); }
+};
+
+// Secondary indexes
+struct FSkillIndexByType
+{
+	using KeyType = ESkillType;
+	static KeyType GetKey(const USkillDataAsset& SkillData) { return SkillData.Type; }
+};
+
+struct FSkillIndexByCategory
+{
+	using KeyType = ESkillCategory;
+	static KeyType GetKey(const USkillDataAsset& SkillData) { return SkillData.Category; }
+};
+
+using FSkillAssetRegistry = TPrimaryAssetRegistry<USkillDataAsset, FSkillAssetTraits, TPrimaryAssetIndexList<FSkillIndexByType, FSkillIndexByCategory>>;
 
 /**
- * Singleton database for managing Skill Data Assets.
+ * Database for managing Skill Data Assets, owned by UActionRPGDataSubsystem (one per game instance).
  * Provides lookup and retrieval of skill data assets by ID, type, or category.
- * Automatically loads all skill data assets via Asset Manager on initialization.
+ * Loads all skill data assets asynchronously via Asset Manager when the game instance starts.
+ * Storage, loading and indexing are provided by FSkillAssetRegistry.
  */
 UCLASS()
 class ACTIONRPG_API USkillDatabase : public UObject
@@ -20,12 +47,19 @@ class ACTIONRPG_API USkillDatabase : public UObject
 	GENERATED_BODY()
 
 public:
-	// Singleton accessor
-	UFUNCTION(BlueprintCallable, Category = "Skill Database")
-	static USkillDatabase* Get();
+	// Accessor - the database of the context object's game instance (nullptr if there is none)
+	UFUNCTION(BlueprintCallable, Category = "Skill Database", meta = (WorldContext = "WorldContextObject"))
+	static USkillDatabase* Get(const UObject* WorldContextObject);
+
+	// UObject interface - keeps registered assets referenced
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
-	// Initialize database - loads all skill data assets
-	void Initialize();
+	// Start loading all skill data assets asynchronously. OnLoaded fires once every asset is registered.
+	void BeginLoad(FSimpleDelegate OnLoaded);
+
+	// True once the initial load has completed (lookups miss until then)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill Database")
+	bool IsReady() const { return bIsReady; }
 
 	// Lookup methods
 	UFUNCTION(BlueprintCallable, Category = "Skill Database")
@@ -34,6 +68,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Skill Database")
 	TArray<USkillDataAsset*> GetAllSkillDataAssets() const;
 
+	// Lookup by dense RuntimeIndex (assigned at registration)
+	USkillDataAsset* GetSkillDataAssetByIndex(int32 SkillIndex) const;
+
+	// Compiled runtime spec by RuntimeIndex / SkillID (nullptr if unknown). Pointers stay valid until the database reloads.
+	const FSkillSpec* GetSkillSpec(int32 SkillIndex) const;
+	const FSkillSpec* FindSkillSpec(FName SkillID) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Skill Database")
 	TArray<USkillDataAsset*> GetSkillsByType(ESkillType SkillType) const;
 
@@ -48,15 +89,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Skill Database|Debug")
 	void PrintAllSkills() const;
 
-	// Create skill instance from data asset
+	// Create skill instance from data asset, owned by Owner (cooldowns are tracked per owner)
 	UFUNCTION(BlueprintCallable, Category = "Skill Database")
-	class USkillBase* CreateSkill(const FName& SkillID) const;
+	class USkillBase* CreateSkill(const FName& SkillID, AActor* Owner = nullptr) const;
+
+	// Underlying asset registry (dense indexes, secondary indexes)
+	const FSkillAssetRegistry& GetRegistry() const { return Registry; }
 
 protected:
-	// Registry of all skill data assets
-	UPROPERTY()
-	TMap<FName, TObjectPtr<USkillDataAsset>> SkillRegistry;
+	// Registry of all skill data assets (RuntimeIndex is the registry's dense index)
+	FSkillAssetRegistry Registry;
+
+	// Immutable skill specs shared by every owner, indexed by RuntimeIndex (built once per load)
+	TArray<FSkillSpec> SkillSpecs;
+
+	void HandleLoadComplete(FSimpleDelegate OnLoaded);
 
-private:
-	static USkillDatabase* Instance;
+	bool bIsReady = false;
 };
@@ -39,10 +39,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Item")
 	EItemType GetItemType() const;
 
+	// Pooling - clears item state and listeners so the instance can be reused
+	virtual void ResetItem();
+
+	// True while the instance is sitting in the item pool's free list
+	bool IsInItemPool() const { return bInItemPool; }
+
 	// Events
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemUsed, UItemBase*, Item);
 	
 	UPROPERTY(BlueprintAssignable, Category = "Item")
 	FOnItemUsed OnItemUsed;
+
+private:
+	friend class UItemInstancePool;
+
+	bool bInItemPool = false;
 };
 
@@ -9,6 +9,7 @@
 
 // Forward declaration
 class AItemPickupActor;
+class UStaticMesh;
 
 /**
  * Data Asset for defining item properties.
@@ -47,6 +48,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|World")
 	TSubclassOf<class AItemPickupActor> ItemPickupActorClass;
 
+	// Mesh drawn for this item on the ground when it is stored without an actor (instanced).
+	// If unset, drops always spawn ItemPickupActorClass.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|World")
+	TObjectPtr<UStaticMesh> WorldMesh;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
 	EItemType Type;
 
@@ -61,5 +67,21 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item")
 	int32 Value;
+
+	// Cooldown started when the item is used (0 = no cooldown)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Cooldown", meta = (ClampMin = "0.0"))
+	float CooldownDuration;
+
+	// Items with the same group share one cooldown (e.g. all health potions). Empty = per ItemID.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Cooldown")
+	FName CooldownGroup;
+
+	// Effects applied when the item is used (compiled into native handlers by the Item Database)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Effects")
+	TArray<FItemEffectDefinition> Effects;
+
+	// Dense index assigned by the Item Database at registration (INDEX_NONE until registered)
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Item|Runtime")
+	int32 RuntimeIndex;
 };
 
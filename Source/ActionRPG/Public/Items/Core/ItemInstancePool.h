@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemInstancePool.generated.h"
+
+class UItemBase;
+class UItemDataAsset;
+
+/**
+ * Hit/miss statistics for the item instance pool.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FItemInstancePoolStats
+{
+	GENERATED_BODY()
+
+	// Acquires served from the free list
+	UPROPERTY(BlueprintReadOnly, Category = "Item Pool")
+	int32 Hits = 0;
+
+	// Acquires that had to construct a new UItemBase
+	UPROPERTY(BlueprintReadOnly, Category = "Item Pool")
+	int32 Misses = 0;
+
+	// Instances returned to the pool
+	UPROPERTY(BlueprintReadOnly, Category = "Item Pool")
+	int32 Releases = 0;
+
+	// Instances discarded because the pool was full
+	UPROPERTY(BlueprintReadOnly, Category = "Item Pool")
+	int32 Discards = 0;
+
+	// Instances currently waiting in the free list
+	UPROPERTY(BlueprintReadOnly, Category = "Item Pool")
+	int32 FreeCount = 0;
+
+	// Highest free list size reached
+	UPROPERTY(BlueprintReadOnly, Category = "Item Pool")
+	int32 PeakFreeCount = 0;
+};
+
+/**
+ * Per-world recycling pool for UItemBase instances.
+ * Inventory stacks, split stacks and temporary pickup templates acquire their instances here
+ * instead of constructing a new UObject each time, and return them when the stack is emptied.
+ * Pre-warms PrewarmCount instances when the world is created (configurable in DefaultGame.ini).
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UItemInstancePool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the pool for the world of the given context object (nullptr if unavailable)
+	static UItemInstancePool* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Get a reset item instance initialized with the given data and quantity
+	UFUNCTION(BlueprintCallable, Category = "Item Pool")
+	UItemBase* Acquire(UItemDataAsset* ItemData, int32 Quantity = 1);
+
+	// Return an item instance to the pool. The caller must not keep any reference to it.
+	UFUNCTION(BlueprintCallable, Category = "Item Pool")
+	void Release(UItemBase* Item);
+
+	// Construct instances until the free list holds at least Count items
+	UFUNCTION(BlueprintCallable, Category = "Item Pool")
+	void Prewarm(int32 Count);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Item Pool")
+	FItemInstancePoolStats GetStats() const { return Stats; }
+
+	// Debug: Print pool statistics to log
+	UFUNCTION(BlueprintCallable, Category = "Item Pool|Debug")
+	void ReportStats() const;
+
+protected:
+	// Number of instances constructed when the world starts
+	UPROPERTY(Config, EditAnywhere, Category = "Item Pool", meta = (ClampMin = "0"))
+	int32 PrewarmCount = 64;
+
+	// Upper bound on free instances kept alive; extra releases are left to GC
+	UPROPERTY(Config, EditAnywhere, Category = "Item Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledItems = 1024;
+
+private:
+	UItemBase* CreateInstance();
+
+	UPROPERTY()
+	TArray<TObjectPtr<UItemBase>> FreeItems;
+
+	FItemInstancePoolStats Stats;
+};
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "ItemTypes.generated.h"
 
+class UStatusEffectDataAsset;
+
 UENUM(BlueprintType)
 enum class EItemType : uint8
 {
@@ -26,3 +28,49 @@ enum class EItemRarity : uint8
 	Legendary		UMETA(DisplayName = "Legendary")
 };
 
+/**
+ * Effect applied when an item is used.
+ * Each value is resolved to a native handler once, when the Item Database compiles its effect table.
+ */
+UENUM(BlueprintType)
+enum class EItemEffectType : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	RestoreHealth	UMETA(DisplayName = "Restore Health"),
+	RestoreMana		UMETA(DisplayName = "Restore Mana"),
+	RestoreStamina	UMETA(DisplayName = "Restore Stamina"),
+	ApplyStatusEffect	UMETA(DisplayName = "Apply Status Effect")	// Magnitude = stacks
+};
+
+/**
+ * Single effect definition authored on an Item Data Asset.
+ * An item can carry several effects; they are applied in order when the item is used.
+ */
+USTRUCT(BlueprintType)
+struct ACTIONRPG_API FItemEffectDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Effects")
+	EItemEffectType EffectType;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Effects")
+	float Magnitude;
+
+	// Buff/debuff applied by ApplyStatusEffect
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Effects")
+	TObjectPtr<UStatusEffectDataAsset> StatusEffect;
+
+	// If true, the item cannot be used while this effect would do nothing (e.g. healing at full health)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Effects")
+	bool bBlockUseWhenIneffective;
+
+	FItemEffectDefinition()
+		: EffectType(EItemEffectType::None), Magnitude(0.0f), StatusEffect(nullptr), bBlockUseWhenIneffective(true)
+	{}
+
+	FItemEffectDefinition(EItemEffectType InEffectType, float InMagnitude)
+		: EffectType(InEffectType), Magnitude(InMagnitude), StatusEffect(nullptr), bBlockUseWhenIneffective(true)
+	{}
+};
+
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Items/Core/ItemTypes.h"
+
+class AActor;
+class UItemDataAsset;
+class UStatusEffectDataAsset;
+
+// Authored parameters handed to an effect handler
+struct FItemEffectParams
+{
+	float Magnitude = 0.0f;
+	UStatusEffectDataAsset* StatusEffect = nullptr;
+};
+
+/**
+ * Compiled item effect table.
+ * Effect definitions authored on Item Data Assets are resolved once (at database initialization)
+ * into native handler pointers stored in a flat array, keyed by the item's dense RuntimeIndex.
+ * Using an item is then a direct table dispatch - no string building or ItemID comparisons.
+ */
+class ACTIONRPG_API FItemEffectTable
+{
+public:
+	// Native handler signatures
+	using FCanApplyFn = bool (*)(AActor& Target, const FItemEffectParams& Params);
+	using FApplyFn = void (*)(AActor& Target, const FItemEffectParams& Params);
+
+	// Clear all compiled effects
+	void Reset();
+
+	// Compile the effects of a single item into the table at the item's RuntimeIndex
+	// (recompiling an item replaces its previous effects, e.g. on hot reload)
+	void CompileItem(const UItemDataAsset& ItemData);
+
+	// Drop the compiled effects of an item (e.g. its asset was removed)
+	void RemoveItem(int32 ItemIndex);
+
+	// Returns true if the item has at least one compiled effect
+	bool HasEffects(int32 ItemIndex) const;
+
+	// Returns false if any blocking effect would do nothing on the target (e.g. healing at full health)
+	bool CanApply(int32 ItemIndex, AActor* Target) const;
+
+	// Apply all compiled effects of the item to the target. Returns true if any effect was applied.
+	bool Apply(int32 ItemIndex, AActor* Target) const;
+
+	int32 GetNumCompiledEffects() const { return Effects.Num(); }
+
+private:
+	struct FCompiledEffect
+	{
+		FCanApplyFn CanApply = nullptr;
+		FApplyFn Apply = nullptr;
+		FItemEffectParams Params;
+		bool bBlockUseWhenIneffective = true;
+	};
+
+	struct FEffectRange
+	{
+		int32 First = 0;
+		int32 Num = 0;
+	};
+
+	// Resolve an effect type to its native handlers (one-time, at compile)
+	static bool ResolveHandlers(EItemEffectType EffectType, FCanApplyFn& OutCanApply, FApplyFn& OutApply);
+
+	// Rebuild Effects without the entries orphaned by recompiles/removals
+	void Compact();
+
+	// Per-item range into Effects, indexed by RuntimeIndex
+	TArray<FEffectRange> Ranges;
+
+	// Flat array of compiled effects
+	TArray<FCompiledEffect> Effects;
+
+	// Entries in Effects no longer referenced by any range
+	int32 NumStaleEffects = 0;
+};
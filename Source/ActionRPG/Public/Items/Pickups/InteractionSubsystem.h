@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InteractionSubsystem.generated.h"
+
+class AItemPickupActor;
+class APlayerController;
+
+/**
+ * Resolves what each local player would interact with.
+ * Every CandidateRefreshInterval, the pickups and stored world items around a local player's pawn
+ * are gathered from the World Item Subsystem's grids into a short candidate list: the nearest to
+ * the pawn or the cursor, with separate budgets for pickups and stored items. Every frame the
+ * cursor ray is traced through the Gameplay Trace Subsystem (async, so the ground point used is
+ * one frame old; the pawn's ground plane stands in until a trace hits) and only those candidates are scored:
+ * 1. Under the cursor - the candidate closest to the cursor point within CursorPickupRadius.
+ * 2. Otherwise, in range - the candidate closest to the pawn within its own InteractionRange.
+ * The winner is cached as the player's hover target, so pressing Interact (or highlighting the
+ * hovered item) costs nothing beyond reading it. Stored items are materialized only when interacted with.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UInteractionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the interaction subsystem for the world of the given context object (nullptr if unavailable)
+	static UInteractionSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Whether the player currently has something to interact with (and where it is)
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	bool GetHoverTarget(const APlayerController* PlayerController, FVector& OutLocation) const;
+
+	// The pickup the player's Interact press applies to; nullptr if none. A stored item is materialized
+	// (bOutMaterialized) and should be stored again with UWorldItemSubsystem::DematerializePickup if it isn't picked up.
+	UFUNCTION(BlueprintCallable, Category = "Interaction")
+	AItemPickupActor* ResolveInteractTarget(APlayerController* PlayerController, bool& bOutMaterialized);
+
+protected:
+	// Radius around the pawn from which candidates are gathered
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "100.0"))
+	float CandidateRadius = 2500.0f;
+
+	// Seconds between candidate refreshes
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "0.0"))
+	float CandidateRefreshInterval = 0.1f;
+
+	// Most pickup actors kept per player (the nearest to the pawn or the cursor)
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "1"))
+	int32 MaxCandidates = 64;
+
+	// Most stored world items kept per player, on top of MaxCandidates
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "1"))
+	int32 MaxStoredCandidates = 64;
+
+	// Most pickups (and, separately, stored items) gathered per refresh before keeping the nearest
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "1"))
+	int32 MaxGatheredCandidates = 1024;
+
+	// Radius around the cursor point that still counts as pointing at an item (easier to hit small items)
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "0.0"))
+	float CursorPickupRadius = 100.0f;
+
+	// Length of the cursor ground trace
+	UPROPERTY(Config, EditAnywhere, Category = "Interaction", meta = (ClampMin = "100.0"))
+	float CursorTraceLength = 100000.0f;
+
+private:
+	// A pickup actor or a stored world item near the player
+	struct FInteractionCandidate
+	{
+		TWeakObjectPtr<AItemPickupActor> Pickup;
+		int32 WorldItemId = INDEX_NONE;
+		FVector Location = FVector::ZeroVector;
+		float InteractionRange = 0.0f;
+	};
+
+	struct FPlayerInteractionState
+	{
+		TArray<FInteractionCandidate> Candidates;
+		float TimeUntilRefresh = 0.0f;
+		int32 HoverIndex = INDEX_NONE;
+
+		// Ground under the cursor from the last completed cursor trace
+		FVector CursorGroundPoint = FVector::ZeroVector;
+		bool bHasCursorGround = false;
+		bool bCursorTracePending = false;
+	};
+
+	void RefreshCandidates(const APlayerController& PlayerController, const APawn& Pawn, FPlayerInteractionState& State);
+
+	// Sort Gathered by distance to the pawn or the cursor (whichever is closer) and append the first Budget to State
+	void KeepNearestCandidates(TArray<FInteractionCandidate>& Gathered, int32 Budget, const FVector2D& Pawn2D,
+		const FVector2D* Cursor2D, FPlayerInteractionState& State) const;
+
+	// Ground point under the cursor: the last cursor trace hit, else the cursor ray on the pawn's ground plane
+	bool GetCursorPoint(const APlayerController& PlayerController, const APawn& Pawn, const FPlayerInteractionState& State, FVector2D& OutCursor2D) const;
+
+	// Queue an async trace along the cursor ray; the result lands in State for a later frame
+	void RequestCursorTrace(const APlayerController& PlayerController, FPlayerInteractionState& State);
+
+	// Score the candidates against the cursor and the pawn; sets State.HoverIndex
+	void UpdateHoverTarget(const APlayerController& PlayerController, const APawn& Pawn, FPlayerInteractionState& State) const;
+
+	// Gather and score right away for a player the tick hasn't seen yet
+	FPlayerInteractionState& FindOrAddState(APlayerController& PlayerController);
+
+	TMap<TObjectKey<APlayerController>, FPlayerInteractionState> PlayerStates;
+
+	// Scratch, reused every refresh
+	TArray<AItemPickupActor*> PickupResults;
+	TArray<int32> WorldItemResults;
+	TArray<FInteractionCandidate> GatheredCandidates;
+};
@@ -7,14 +7,21 @@
 #include "Items/Core/ItemDataAsset.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
+#include "Items/Pickups/LootLifetimeSubsystem.h"
 #include "ItemPickupActor.generated.h"
 
 class AActionRPGPlayerCharacter;
 
 /**
  * Actor that represents an item pickup in the world.
- * Supports both automatic pickup on overlap (if enabled) and manual interaction via IA_Interact.
- * Supports visual representation, collision detection, and inventory integration.
+ * Supports both automatic pickup when a player comes into range (if enabled) and manual interaction via IA_Interact.
+ * Pickups have no collision; they are registered with the World Item Subsystem, which finds them
+ * with grid queries and drives auto-pickup from the player side.
+ *
+ * Replication: a pickup starts net-dormant and is only flushed when something clients can see
+ * changes (item, quantity, activation from or return to the pickup pool). Relevancy is limited by
+ * the actor's net cull distance, pooled pickups are relevant to nobody, and personal loot is only
+ * relevant to (and only collectable by) its owner.
  */
 UCLASS(BlueprintType, Blueprintable)
 class ACTIONRPG_API AItemPickupActor : public AActor
@@ -24,6 +31,10 @@ class ACTIONRPG_API AItemPickupActor : public AActor
 public:
 	AItemPickupActor();
 
+	// AActor interface
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
+
 	// Interaction Functions
 	UFUNCTION(BlueprintCallable, Category = "Pickup")
 	bool IsPlayerInRange(AActionRPGPlayerCharacter* Player) const;
@@ -45,6 +56,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pickup")
 	int32 GetQuantity() const { return Quantity; }
 
+	float GetInteractionRange() const { return InteractionRange; }
+	bool IsAutoPickupEnabled() const { return bAutoPickupOnOverlap; }
+
+	// Make this pickup visible to and collectable by LootOwner only (nullptr = everyone)
+	UFUNCTION(BlueprintCallable, Category = "Pickup")
+	void SetPersonalLoot(AActor* LootOwner);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pickup")
+	bool IsPersonalLoot() const { return bOnlyRelevantToOwner && GetOwner() != nullptr; }
+
+	// Pooling (driven by UPickupActorPool): an inactive pickup is hidden, holds no item and is not in the world item index
+	void ActivatePickup(const FVector& Location);
+	void DeactivatePickup();
+	bool IsInPickupPool() const { return bInPickupPool; }
+
 	// Pickup Logic (public for cursor-based pickup)
 	UFUNCTION(BlueprintCallable, Category = "Pickup")
 	void PickupItem(AActionRPGPlayerCharacter* Player);
@@ -52,20 +78,35 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pickup")
 	bool CanPickup(AActionRPGPlayerCharacter* Player) const;
 
+	// Ownership part of CanPickup (personal loot, loot ownership window); no inventory check
+	bool IsLootableBy(const AActionRPGPlayerCharacter* Player) const;
+
+	// Record of this pickup in the Loot Lifetime Subsystem (unset if untracked)
+	const FLootHandle& GetLootHandle() const { return LootHandle; }
+
+	// The contents went into an inventory: play the pickup effect and remove the pickup
+	void CompletePickup();
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Item Data
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Pickup")
 	TObjectPtr<UItemDataAsset> ItemData;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = "Pickup")
 	int32 Quantity = 1;
 
+	// Distance beyond which the pickup is not replicated to a connection
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup|Network", meta = (ClampMin = "0.0"))
+	float PickupNetCullDistance = 5000.0f;
+
 	// Interaction Settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup", meta = (ClampMin = "0.0", ClampMax = "1000.0"))
 	float InteractionRange = 150.0f;
 
+	// Picked up automatically when a player comes within InteractionRange (polled by the World Item Subsystem)
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pickup")
 	bool bAutoPickupOnOverlap = false;
 
@@ -77,11 +118,6 @@ protected:
 	TObjectPtr<USphereComponent> CollisionComponent;
 
 	// Pickup Logic (protected for internal use)
-	UFUNCTION()
-	void OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-	                    UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
-	                    bool bFromSweep, const FHitResult& SweepResult);
-	
 	void SpawnPickupEffect();
 	void DestroyPickup();
 
@@ -92,4 +128,16 @@ protected:
 	// Debug
 	UFUNCTION(BlueprintCallable, Category = "Pickup|Debug")
 	void DebugCollisionSettings() const;
+
+	// Send pending changes to clients; the pickup goes back to sleep after the next net update
+	void WakeForReplication();
+
+private:
+	friend class UPickupActorPool;
+	friend class ULootLifetimeSubsystem;
+
+	bool bInPickupPool = false;
+
+	// Despawn clock and ownership of a dropped pickup (unset for placed pickups)
+	FLootHandle LootHandle;
 };
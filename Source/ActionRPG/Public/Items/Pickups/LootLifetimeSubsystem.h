@@ -0,0 +1,183 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/HierarchicalTimerWheel.h"
+#include "Items/Core/ItemTypes.h"
+#include "LootLifetimeSubsystem.generated.h"
+
+class AItemPickupActor;
+
+/**
+ * How long dropped loot of one rarity stays on the ground.
+ */
+USTRUCT()
+struct FLootRarityRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Loot")
+	EItemRarity Rarity = EItemRarity::Common;
+
+	// Seconds until the loot despawns (0 = only evicted by the global cap)
+	UPROPERTY(EditAnywhere, Category = "Loot", meta = (ClampMin = "0.0"))
+	float Lifetime = 300.0f;
+
+	// Seconds during which only the loot's owner can pick it up
+	UPROPERTY(EditAnywhere, Category = "Loot", meta = (ClampMin = "0.0"))
+	float OwnershipWindow = 30.0f;
+};
+
+/**
+ * Handle to a loot record of the Loot Lifetime Subsystem.
+ */
+struct FLootHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Generation = 0; }
+};
+
+/**
+ * Despawns dropped loot so ground items never accumulate without bound.
+ * Every dropped pickup actor or stored world item gets a record with its rarity, owner and
+ * drop time. Expiry is scheduled on a hierarchical timer wheel, so a frame only touches loot
+ * that actually expires. Until its OwnershipWindow ends, loot can only be picked up by its owner;
+ * after that it is free-for-all.
+ * At most MaxTrackedLoot records exist: dropping beyond the cap evicts the oldest loot of the
+ * lowest rarity on the ground (records sit in one drop-ordered list per rarity).
+ * Lifetimes and windows per rarity are configured in DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API ULootLifetimeSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the loot lifetime manager for the world of the given context object (nullptr if unavailable)
+	static ULootLifetimeSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Start the despawn clock of a dropped pickup actor (LootOwner null = free-for-all right away)
+	void TrackPickup(AItemPickupActor& Pickup, AActor* LootOwner);
+
+	// Start the despawn clock of a stored world item; the returned handle is kept by its entry
+	FLootHandle TrackWorldItem(int32 EntryId, EItemRarity Rarity, AActor* LootOwner);
+
+	// Hand a stored item's record to the pickup actor that replaced it (keeps its clock and owner)
+	void TransferToPickup(FLootHandle& Handle, AItemPickupActor& Pickup);
+
+	// Hand a pickup actor's record back to the stored item that replaced it; returns the entry's handle (unset if untracked)
+	FLootHandle TransferToWorldItem(AItemPickupActor& Pickup, int32 EntryId);
+
+	// Forget loot that was picked up or removed. Stale handles are ignored.
+	void UntrackLoot(FLootHandle& Handle);
+
+	// False while the loot is inside its ownership window and Looter is not its owner
+	bool CanLoot(const FLootHandle& Handle, const AActor* Looter) const;
+
+	// Seconds until the loot despawns (0 if untracked or it never expires)
+	float GetTimeRemaining(const FLootHandle& Handle) const;
+
+	// Whether loot dropped by LootOwner may be added to this loot: same owner, and LootOwner can loot it
+	bool CanMergeLoot(const FLootHandle& Handle, const AActor* LootOwner) const;
+
+	// Loot of Rarity was added to this loot: its clock and ownership window end at the later of the two,
+	// and it counts as the newest drop of its rarity for eviction
+	void RefreshMergedLoot(const FLootHandle& Handle, EItemRarity Rarity);
+
+	// Evict down to one below MaxTrackedLoot. Called before a drop is merged into piles, so the new
+	// drop's record can't evict the pile that just absorbed part of it.
+	void MakeRoomForLoot();
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Loot")
+	int32 GetNumTrackedLoot() const { return NumTrackedLoot; }
+
+protected:
+	// Hard cap on loot on the ground; dropping beyond it evicts the oldest, most common loot
+	UPROPERTY(Config, EditAnywhere, Category = "Loot", meta = (ClampMin = "1"))
+	int32 MaxTrackedLoot = 2000;
+
+	// Resolution of expiry times in seconds
+	UPROPERTY(Config, EditAnywhere, Category = "Loot", meta = (ClampMin = "0.01"))
+	float TimerTickInterval = 0.25f;
+
+	// Used for rarities without a rule
+	UPROPERTY(Config, EditAnywhere, Category = "Loot", meta = (ClampMin = "0.0"))
+	float DefaultLifetime = 300.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Loot", meta = (ClampMin = "0.0"))
+	float DefaultOwnershipWindow = 30.0f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Loot")
+	TArray<FLootRarityRule> RarityRules;
+
+private:
+	static constexpr int32 NumRarities = static_cast<int32>(EItemRarity::Legendary) + 1;
+
+	struct FLootRecord
+	{
+		// Exactly one of these is set
+		TWeakObjectPtr<AItemPickupActor> Pickup;
+		int32 WorldItemId = INDEX_NONE;
+
+		TWeakObjectPtr<AActor> LootOwner;
+		double OwnershipEndTime = 0.0;
+		FTimerWheelHandle ExpiryTimer;
+
+		// Drop-ordered list of the records of the same rarity
+		int32 Rarity = 0;
+		int32 PrevInRarity = INDEX_NONE;
+		int32 NextInRarity = INDEX_NONE;
+
+		uint32 Generation = 0;
+		bool bInUse = false;
+	};
+
+	FLootHandle AddRecord(EItemRarity Rarity, AActor* LootOwner);
+	void RemoveRecord(int32 RecordIndex);
+	bool IsRecordCurrent(const FLootHandle& Handle) const;
+
+	// Drop-ordered rarity lists
+	void LinkRarityTail(int32 RecordIndex);
+	void UnlinkRarity(int32 RecordIndex);
+
+	// Remove the loot itself (expiry or eviction); the record is freed first
+	void DespawnLoot(int32 RecordIndex);
+
+	// Despawn the oldest loot of the lowest rarity on the ground (false if there is none)
+	bool EvictOldestLoot();
+
+	void HandleExpiryTimer(uint64 Payload);
+
+	static uint64 MakePayload(int32 RecordIndex, uint32 Generation) { return (uint64(Generation) << 32) | uint32(RecordIndex); }
+
+	double GetWorldTime() const;
+
+	FHierarchicalTimerWheel TimerWheel;
+
+	// Records (recycled through FreeRecords, so memory stays flat with the cap)
+	TArray<FLootRecord> Records;
+	TArray<int32> FreeRecords;
+	int32 NumTrackedLoot = 0;
+
+	// Oldest and newest record of each rarity
+	int32 RarityHeads[NumRarities];
+	int32 RarityTails[NumRarities];
+
+	// Resolved from the config, indexed by rarity
+	float Lifetimes[NumRarities];
+	float OwnershipWindows[NumRarities];
+};
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PickupActorPool.generated.h"
+
+class AItemPickupActor;
+
+/**
+ * Free pickup actors of one class.
+ */
+USTRUCT()
+struct FPickupActorFreeList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AItemPickupActor>> FreeActors;
+};
+
+/**
+ * Per-world, per-class pool of item pickup actors.
+ * Dropping an item acquires a pickup here instead of spawning one, and picking it up returns it
+ * instead of destroying it: pooled pickups are hidden and removed from the world item index, then
+ * re-activated at the next drop location with new ItemData/Quantity.
+ * When the world begins play, PrewarmCountPerClass pickups are spawned for the base class and for
+ * every ItemPickupActorClass used by the item database (configurable in DefaultGame.ini).
+ * Pickups replicate and are owned by the server, so the pool only works in non-client worlds:
+ * on a client Acquire returns nullptr and Release/Prewarm do nothing.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UPickupActorPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the pool for the world of the given context object (nullptr if unavailable)
+	static UPickupActorPool* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// Get an active pickup of the given class at Location (spawned if the free list is empty)
+	UFUNCTION(BlueprintCallable, Category = "Pickup Pool")
+	AItemPickupActor* AcquirePickup(TSubclassOf<AItemPickupActor> PickupClass, FVector Location);
+
+	// Deactivate a pickup and keep it for reuse. The caller must not keep any reference to it.
+	UFUNCTION(BlueprintCallable, Category = "Pickup Pool")
+	void ReleasePickup(AItemPickupActor* Pickup);
+
+	// Spawn inactive pickups until the class's free list holds at least Count
+	UFUNCTION(BlueprintCallable, Category = "Pickup Pool")
+	void Prewarm(TSubclassOf<AItemPickupActor> PickupClass, int32 Count);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pickup Pool")
+	int32 GetNumFreePickups() const { return NumFreePickups; }
+
+protected:
+	// Inactive pickups spawned per class when the world begins play
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup Pool", meta = (ClampMin = "0"))
+	int32 PrewarmCountPerClass = 16;
+
+	// Upper bound on free pickups kept per class; extra releases are destroyed
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup Pool", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 256;
+
+private:
+	AItemPickupActor* SpawnPickup(UWorld& World, UClass* PickupClass, const FVector& Location, bool bPooled);
+
+	// Pre-warm every pickup class referenced by the item database
+	UFUNCTION()
+	void PrewarmItemClasses();
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FPickupActorFreeList> FreeLists;
+
+	int32 NumFreePickups = 0;
+};
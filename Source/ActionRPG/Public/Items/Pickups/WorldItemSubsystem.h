@@ -0,0 +1,215 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "Core/UniformGridIndex.h"
+#include "Items/Pickups/LootLifetimeSubsystem.h"
+#include "WorldItemSubsystem.generated.h"
+
+class AItemPickupActor;
+class AActionRPGPlayerCharacter;
+class UItemDataAsset;
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+class APlayerController;
+
+/**
+ * Spatial index of every item pickup in the world.
+ * Pickups have no overlap collision of their own; they register here on BeginPlay and are found
+ * with grid queries instead, so their cost no longer scales with the physics broadphase.
+ *
+ * Items can also be stored without any actor (AddWorldItem): an entry holds the item index,
+ * quantity, transform and loot handle, sits in its own grid, and is drawn as one instance of an
+ * instanced static mesh component per WorldMesh. An entry is materialized into a pooled
+ * AItemPickupActor only when a player interacts with it, so TryInteract and PickupItem behave
+ * exactly as for dropped actors; if that pickup fails, the actor is stored again (DematerializePickup).
+ * Stored items are not replicated: entries and their instanced meshes exist only in the local world.
+ * They are therefore only used in standalone games - with any net mode, AddWorldItem and
+ * DematerializePickup return INDEX_NONE and drops fall back to replicated pickup actors.
+ *
+ * Auto-pickup runs from the player side at a fixed cadence: every AutoPickupInterval, each
+ * locally-authoritative player character queries the pickups and stored items around it and
+ * gathers the auto-pickup ones that came into InteractionRange since the previous poll (the same
+ * "on enter" behaviour the overlap events had). The whole sweep goes into the inventory with one
+ * AddItemsBulk call - one capacity check and one inventory event - and the accepted pickups are
+ * retired together; stored items are removed without ever becoming actors.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UWorldItemSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the world item index for the world of the given context object (nullptr if unavailable)
+	static UWorldItemSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Registration (called by AItemPickupActor on BeginPlay/EndPlay)
+	void RegisterPickup(AItemPickupActor* Pickup);
+	void UnregisterPickup(AItemPickupActor* Pickup);
+
+	// Pickups within Radius of Center (XY); returns the number written to OutPickups (capped by its size)
+	int32 QueryPickupsInRadius(const FVector& Center, float Radius, TArrayView<AItemPickupActor*> OutPickups) const;
+
+	// Closest pickup to Location within Radius (nullptr if none)
+	AItemPickupActor* FindClosestPickup(const FVector& Location, float Radius) const;
+
+	// Blueprint convenience (allocates the result array)
+	UFUNCTION(BlueprintCallable, Category = "Pickup")
+	void FindPickupsInRadius(FVector Center, float Radius, TArray<AItemPickupActor*>& OutPickups, int32 MaxResults = 256) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pickup")
+	int32 GetNumRegisteredPickups() const { return Grid.Num(); }
+
+	// Pickup actors currently net-relevant to a player's connection (within cull distance, not
+	// pooled, not someone else's personal loot)
+	UFUNCTION(BlueprintCallable, Category = "Pickup")
+	int32 GetNumRelevantPickups(const APlayerController* Connection) const;
+
+	// Store an item on the ground without an actor. Returns the entry id, or INDEX_NONE if the item
+	// can't be stored this way (no WorldMesh, not registered in the item database, or a networked game).
+	// The entry is dropped loot: it despawns through the Loot Lifetime Subsystem and belongs to LootOwner for a while.
+	UFUNCTION(BlueprintCallable, Category = "Pickup")
+	int32 AddWorldItem(UItemDataAsset* ItemData, int32 Quantity, FTransform Transform, AActor* LootOwner = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category = "Pickup")
+	bool RemoveWorldItem(int32 EntryId);
+
+	// Replace a stored item by a pickup actor holding the same item and quantity
+	UFUNCTION(BlueprintCallable, Category = "Pickup")
+	AItemPickupActor* MaterializeWorldItem(int32 EntryId);
+
+	// Reverse of MaterializeWorldItem: store the pickup's item again and release the actor. The entry
+	// keeps the pickup's despawn clock and owner. Returns the entry id, or INDEX_NONE (pickup kept)
+	// if the item can't be stored.
+	int32 DematerializePickup(AItemPickupActor* Pickup);
+
+	// Stored items within Radius of Center (XY); returns the number written to OutEntries (capped by its size)
+	int32 QueryWorldItemsInRadius(const FVector& Center, float Radius, TArrayView<int32> OutEntries) const;
+
+	// Location and interaction range of a stored item (false if the id is not in use)
+	bool GetWorldItemInfo(int32 EntryId, FVector& OutLocation, float& OutInteractionRange) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pickup")
+	int32 GetNumWorldItems() const { return ItemGrid.Num(); }
+
+	// Whether items can be stored without actors in this world (standalone games only - entries don't replicate)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pickup")
+	bool CanStoreWorldItems() const;
+
+	// Add up to Quantity of ItemData to piles of the same item (stored or actor) within MergeRadius
+	// of Location, each capped at MaxPileQuantity. Only piles of the same loot owner that it can loot
+	// are used, and their despawn clocks are extended to the new loot's. At the loot cap, the oldest loot
+	// is evicted before merging rather than when the remainder is tracked. Returns the quantity absorbed.
+	int32 MergeIntoNearbyPiles(const UItemDataAsset* ItemData, int32 Quantity, const FVector& Location, AActor* LootOwner = nullptr);
+
+protected:
+	// Grid cell edge length in world units
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup", meta = (ClampMin = "50.0"))
+	float CellSize = 500.0f;
+
+	// Seconds between auto-pickup polls
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup", meta = (ClampMin = "0.0"))
+	float AutoPickupInterval = 0.1f;
+
+	// Most pickups a single query can return
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup", meta = (ClampMin = "1"))
+	int32 MaxQueryResults = 256;
+
+	// Drops within this distance of a pile of the same item are added to it (0 = never merge)
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup|Merging", meta = (ClampMin = "0.0"))
+	float MergeRadius = 150.0f;
+
+	// Largest quantity a merged pile can reach
+	UPROPERTY(Config, EditAnywhere, Category = "Pickup|Merging", meta = (ClampMin = "1"))
+	int32 MaxPileQuantity = 999;
+
+private:
+	void HandleTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, int32 GridId);
+
+	// Collect auto-pickups that came into range of a player since the last poll, as one bulk add
+	void UpdateAutoPickup(AActionRPGPlayerCharacter& Player);
+
+	// Stored items
+	struct FWorldItemEntry
+	{
+		// Item database RuntimeIndex - process-local, so entries must not be saved or replicated as-is
+		int32 ItemIndex = INDEX_NONE;
+		int32 Quantity = 0;
+		FTransform Transform;
+		FLootHandle LootHandle;
+		int32 GridId = INDEX_NONE;
+		int32 BatchIndex = INDEX_NONE;
+		int32 InstanceIndex = INDEX_NONE;
+		float InteractionRange = 0.0f;
+		bool bAutoPickup = false;
+		bool bInUse = false;
+	};
+
+	int32 FindOrAddMeshBatch(UStaticMesh& Mesh);
+
+	// Create a stored item entry without a loot record (INDEX_NONE if the item can't be stored)
+	int32 AddWorldItemEntry(UItemDataAsset* ItemData, int32 Quantity, const FTransform& Transform);
+	void RemoveWorldItemEntry(int32 EntryId);
+
+	struct FRegistration
+	{
+		int32 GridId = INDEX_NONE;
+		bool bAutoPickup = false;
+		TWeakObjectPtr<USceneComponent> RootComponent;
+		FDelegateHandle TransformUpdatedHandle;
+	};
+
+	// Pickups are unregistered on EndPlay, so raw pointers in the grid never dangle
+	TUniformGridIndex<AItemPickupActor*> Grid;
+	TMap<TObjectKey<AItemPickupActor>, FRegistration> Registrations;
+
+	// Largest InteractionRange of any registered pickup (auto-pickup query radius)
+	float MaxInteractionRange = 0.0f;
+
+	// Largest net cull distance of any registered pickup (relevancy count query radius)
+	float MaxNetCullDistance = 0.0f;
+	int32 NumAutoPickups = 0;
+	float TimeUntilAutoPickup = 0.0f;
+
+	// Auto-pickups (actors and stored items) each player was in range of at the last poll; entries
+	// are dropped when their pickup is unregistered or their stored item removed
+	struct FAutoPickupsInRange
+	{
+		TArray<TObjectKey<AItemPickupActor>> Pickups;
+		TArray<int32> WorldItems;
+	};
+	TMap<TObjectKey<AActionRPGPlayerCharacter>, FAutoPickupsInRange> PickupsInRange;
+
+	// Scratch, reused every poll
+	TArray<AItemPickupActor*> QueryResults;
+	TArray<int32> WorldItemQueryResults;
+
+	// Stored items (ids are indexes, recycled through FreeWorldItems)
+	TArray<FWorldItemEntry> WorldItems;
+	TArray<int32> FreeWorldItems;
+	TUniformGridIndex<int32> ItemGrid;
+	float MaxWorldItemInteractionRange = 0.0f;
+	int32 NumAutoPickupWorldItems = 0;
+
+	// One instanced mesh component per WorldMesh; BatchInstanceEntries maps instance index -> entry id
+	UPROPERTY()
+	TObjectPtr<AActor> WorldItemRenderer;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UInstancedStaticMeshComponent>> BatchComponents;
+
+	TArray<TArray<int32>> BatchInstanceEntries;
+	TMap<TObjectKey<UStaticMesh>, int32> BatchLookup;
+};
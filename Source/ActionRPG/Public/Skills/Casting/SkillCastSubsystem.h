@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/HierarchicalTimerWheel.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
+#include "SkillCastSubsystem.generated.h"
+
+class USkillBase;
+class USkillDataAsset;
+struct FSkillSpec;
+
+UENUM(BlueprintType)
+enum class ESkillCastPhase : uint8
+{
+	None		UMETA(DisplayName = "None"),
+	Casting		UMETA(DisplayName = "Casting"),
+	Channeling	UMETA(DisplayName = "Channeling"),
+	Recovery	UMETA(DisplayName = "Recovery")
+};
+
+UENUM(BlueprintType)
+enum class ESkillCastEndReason : uint8
+{
+	Completed	UMETA(DisplayName = "Completed"),
+	Interrupted	UMETA(DisplayName = "Interrupted"),
+	Cancelled	UMETA(DisplayName = "Cancelled")
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSkillCastPhaseChanged, AActor*, Caster, USkillDataAsset*, SkillData, ESkillCastPhase, Phase);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSkillCastEnded, AActor*, Caster, USkillDataAsset*, SkillData, ESkillCastEndReason, Reason);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnSkillCastExecuted, AActor*, Caster, USkillDataAsset*, SkillData, AActor*, Target);
+
+/**
+ * Drives the cast -> channel -> recovery pipeline for every caster in the world.
+ * Each caster has at most one active cast; the end of its current phase is a single timer on a
+ * hierarchical timer wheel, so a frame only does work for casts whose phase is actually ending.
+ *
+ * Casts reference skills by spec index (FSkillSpec), so casters need no USkillBase objects;
+ * a USkillBase passed to BeginCast is only kept to run its ExecuteSkill override.
+ *
+ * Phases (durations come from the skill spec):
+ * - Casting (CastTime): cooldown and costs are committed when the cast starts. Cancelling refunds them.
+ * - Channeling (ChannelDuration): starts when the skill executes (OnSkillExecuted fires here).
+ * - Recovery (RecoveryTime): caster is locked out; a queued skill starts when recovery ends.
+ */
+UCLASS()
+class ACTIONRPG_API USkillCastSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the cast subsystem for the world of the given context object (nullptr if unavailable)
+	static USkillCastSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Start casting a skill for its owning actor. If the caster is already busy the skill is queued
+	// (replacing any previously queued skill) and starts when the current cast completes.
+	UFUNCTION(BlueprintCallable, Category = "Skill|Casting")
+	bool BeginCast(USkillBase* Skill, AActor* Target = nullptr);
+
+	// Same, by skill spec index (FSkillSpec::SkillIndex). SkillObject optionally overrides execution.
+	bool BeginSkillCast(AActor* Caster, int32 SkillIndex, AActor* Target = nullptr, USkillBase* SkillObject = nullptr);
+
+	// Stop the caster's current cast because of an outside event (stun, knockback). Cooldown is kept.
+	UFUNCTION(BlueprintCallable, Category = "Skill|Casting")
+	bool InterruptCast(AActor* Caster);
+
+	// Stop the caster's current cast voluntarily. Cooldown and costs are refunded if the skill had not executed yet.
+	UFUNCTION(BlueprintCallable, Category = "Skill|Casting")
+	bool CancelCast(AActor* Caster);
+
+	UFUNCTION(BlueprintCallable, Category = "Skill|Casting")
+	void ClearQueuedSkill(AActor* Caster);
+
+	// Cast state queries
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill|Casting")
+	ESkillCastPhase GetCastPhase(const AActor* Caster) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill|Casting")
+	bool IsCasting(const AActor* Caster) const { return GetCastPhase(Caster) != ESkillCastPhase::None; }
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill|Casting")
+	USkillDataAsset* GetCastingSkillData(const AActor* Caster) const;
+
+	// Spec index of the skill being cast / queued (INDEX_NONE if none)
+	int32 GetCastingSkillIndex(const AActor* Caster) const;
+	int32 GetQueuedSkillIndex(const AActor* Caster) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill|Casting")
+	float GetPhaseTimeRemaining(const AActor* Caster) const;
+
+	int32 GetNumActiveCasts() const { return CastLookup.Num(); }
+
+	// Events
+	UPROPERTY(BlueprintAssignable, Category = "Skill|Casting")
+	FOnSkillCastPhaseChanged OnCastPhaseChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "Skill|Casting")
+	FOnSkillCastEnded OnCastEnded;
+
+	// Fired when a cast executes (end of cast time), before channeling starts
+	UPROPERTY(BlueprintAssignable, Category = "Skill|Casting")
+	FOnSkillCastExecuted OnSkillExecuted;
+
+private:
+	struct FSkillCast
+	{
+		int32 SkillIndex = INDEX_NONE;
+		TWeakObjectPtr<USkillBase> SkillObject;
+		TWeakObjectPtr<AActor> Caster;
+		TWeakObjectPtr<AActor> Target;
+		FObjectKey CasterKey;
+		ESkillCastPhase Phase = ESkillCastPhase::None;
+		FTimerWheelHandle PhaseTimer;
+
+		// Cooldowns committed by this cast and their previous expiries, restored on cancel
+		FCooldownHandle CooldownHandle;
+		FCooldownHandle GroupCooldownHandle;
+		double PreviousCooldownExpiry = 0.0;
+		double PreviousGroupCooldownExpiry = 0.0;
+
+		// Skill to start when this cast completes
+		int32 QueuedSkillIndex = INDEX_NONE;
+		TWeakObjectPtr<USkillBase> QueuedSkillObject;
+		TWeakObjectPtr<AActor> QueuedTarget;
+
+		// Bumped whenever the slot starts a new skill or is released (invalidates stale timers)
+		uint32 Generation = 0;
+		bool bExecuted = false;
+		bool bInUse = false;
+	};
+
+	int32 FindCast(const AActor* Caster) const;
+	int32 AllocateCast(AActor* Caster);
+	void ReleaseCast(int32 CastIndex);
+
+	const FSkillSpec* FindSpec(int32 SkillIndex) const;
+	USkillDataAsset* GetSkillData(int32 SkillIndex) const;
+
+	// Begin the cast phase of a skill in an allocated slot (executes immediately when CastTime is 0)
+	bool StartSkill(int32 CastIndex, int32 SkillIndex, AActor* Target, USkillBase* SkillObject);
+
+	// Switch phase and schedule its end on the timer wheel
+	void EnterPhase(int32 CastIndex, ESkillCastPhase Phase, float Duration);
+
+	// Execute the skill and move on to channeling/recovery
+	void ExecuteCast(int32 CastIndex);
+
+	// Called when the current phase timer expires
+	void AdvanceCast(int32 CastIndex);
+
+	void EndCast(int32 CastIndex, ESkillCastEndReason Reason);
+
+	void HandlePhaseTimerExpired(uint64 Payload);
+
+	// True if the slot still runs the cast started with this generation (listeners may end or replace it)
+	bool IsCastCurrent(int32 CastIndex, uint32 Generation) const;
+
+	static uint64 MakePayload(int32 CastIndex, uint32 Generation) { return (uint64(Generation) << 32) | uint32(CastIndex); }
+
+	FHierarchicalTimerWheel TimerWheel;
+
+	TArray<FSkillCast> Casts;
+	TArray<int32> FreeCasts;
+	TMap<FObjectKey, int32> CastLookup;
+};
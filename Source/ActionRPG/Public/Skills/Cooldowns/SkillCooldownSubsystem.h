@@ -0,0 +1,125 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SkillCooldownSubsystem.generated.h"
+
+class USkillDataAsset;
+class UItemDataAsset;
+
+/**
+ * Stable reference to a cooldown entry (owner + cooldown ID).
+ * Resolving a valid handle is an array index and a generation compare - no hashing.
+ */
+struct FCooldownHandle
+{
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+
+	bool IsSet() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; Generation = 0; }
+};
+
+/**
+ * Timestamp-based cooldown manager.
+ * Each (owner, cooldown ID) pair owns one slot in a compact array holding the absolute time
+ * the cooldown expires (server world time when available). Nothing ticks: starting a cooldown
+ * writes an expiry, querying one subtracts the current time from it.
+ *
+ * Cooldown IDs:
+ * - Skills use SharedCooldownID if set (skills sharing one timer), otherwise their SkillID.
+ *   Skills with a CooldownGroup also lock out the whole group for CooldownGroupDuration.
+ * - Consumable items use their CooldownGroup if set (e.g. all potions), otherwise their ItemID.
+ */
+UCLASS()
+class ACTIONRPG_API USkillCooldownSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the cooldown manager for the world of the given context object (nullptr if unavailable)
+	static USkillCooldownSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// Current cooldown clock (server world time if replicated, otherwise world time)
+	double GetCooldownTime() const;
+
+	// Generic cooldowns
+	FCooldownHandle FindOrAddCooldown(const UObject* Owner, FName CooldownID);
+	bool IsHandleValid(const FCooldownHandle& Handle) const;
+
+	// Start (or restart) a cooldown. Never shortens a cooldown that is already running longer.
+	FCooldownHandle StartCooldown(const UObject* Owner, FName CooldownID, float Duration);
+	void StartCooldown(const FCooldownHandle& Handle, float Duration);
+
+	// O(1): expiry minus now (0 when ready or unknown)
+	float GetRemaining(const FCooldownHandle& Handle) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Cooldowns")
+	float GetCooldownRemaining(const UObject* Owner, FName CooldownID) const;
+
+	// Absolute expiry time of a cooldown (0 if never started); used to restore a cooldown on refund
+	double GetCooldownExpiry(const FCooldownHandle& Handle) const;
+	void SetCooldownExpiry(const FCooldownHandle& Handle, double ExpiryTime);
+
+	UFUNCTION(BlueprintCallable, Category = "Cooldowns")
+	void ClearCooldown(const UObject* Owner, FName CooldownID);
+
+	// Skills
+	static FName GetSkillCooldownID(const USkillDataAsset& SkillData);
+	void CommitSkillCooldown(const UObject* Owner, const USkillDataAsset& SkillData);
+	float GetSkillCooldownRemaining(const UObject* Owner, const USkillDataAsset& SkillData) const;
+
+	// Consumables
+	static FName GetItemCooldownID(const UItemDataAsset& ItemData);
+	void CommitItemCooldown(const UObject* Owner, const UItemDataAsset& ItemData);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Cooldowns")
+	float GetItemCooldownRemaining(const UObject* Owner, const UItemDataAsset* ItemData) const;
+
+	// Debug: Print live cooldowns to log
+	UFUNCTION(BlueprintCallable, Category = "Cooldowns|Debug")
+	void ReportCooldowns() const;
+
+private:
+	struct FCooldownKey
+	{
+		FObjectKey Owner;
+		FName CooldownID;
+
+		bool operator==(const FCooldownKey& Other) const { return Owner == Other.Owner && CooldownID == Other.CooldownID; }
+		friend uint32 GetTypeHash(const FCooldownKey& Key) { return HashCombine(GetTypeHash(Key.Owner), GetTypeHash(Key.CooldownID)); }
+	};
+
+	// Cold per-slot data (only touched when slots are created or purged)
+	struct FCooldownSlotInfo
+	{
+		FCooldownKey Key;
+		TWeakObjectPtr<const UObject> Owner;
+		uint32 Generation = 0;
+		bool bInUse = false;
+	};
+
+	int32 FindSlot(const UObject* Owner, FName CooldownID) const;
+	int32 AllocateSlot(const UObject* Owner, FName CooldownID);
+
+	// Release slots whose owner no longer exists
+	void PurgeStaleOwners();
+
+	// Hot data: absolute expiry time per slot
+	TArray<double> ExpiryTimes;
+
+	// Cold data, parallel to ExpiryTimes
+	TArray<FCooldownSlotInfo> SlotInfos;
+
+	TArray<int32> FreeSlots;
+	TMap<FCooldownKey, int32> SlotLookup;
+
+	// Slot count at which stale owners are purged next (amortized, no ticking)
+	int32 NextPurgeSlotCount = 64;
+};
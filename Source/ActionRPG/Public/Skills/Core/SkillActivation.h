@@ -0,0 +1,42 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skills/Core/SkillSpec.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
+
+class UAttributeComponent;
+
+/**
+ * Stateless skill activation rules over a shared FSkillSpec.
+ * Callers own the per-owner state (cooldown handles in an FSkillLoadout or a USkillBase) and pass
+ * it in; nothing here allocates or stores anything.
+ */
+struct ACTIONRPG_API FSkillActivation
+{
+	// Resolve the cooldown slots for (CooldownOwner, spec); handles that are still valid are kept as-is
+	static void ResolveCooldownHandles(const FSkillSpec& Spec, USkillCooldownSubsystem& Cooldowns, const UObject* CooldownOwner,
+		FCooldownHandle& InOutCooldownHandle, FCooldownHandle& InOutGroupCooldownHandle);
+
+	// Longest of the skill and group cooldowns
+	static float GetCooldownRemaining(const USkillCooldownSubsystem& Cooldowns, const FCooldownHandle& CooldownHandle, const FCooldownHandle& GroupCooldownHandle);
+
+	// Start the skill and group cooldowns; outputs the previous expiries so they can be restored
+	static void CommitCooldown(const FSkillSpec& Spec, USkillCooldownSubsystem& Cooldowns, const FCooldownHandle& CooldownHandle,
+		const FCooldownHandle& GroupCooldownHandle, double& OutPreviousExpiry, double& OutPreviousGroupExpiry);
+
+	static void RestoreCooldown(USkillCooldownSubsystem& Cooldowns, const FCooldownHandle& CooldownHandle, const FCooldownHandle& GroupCooldownHandle,
+		double PreviousExpiry, double PreviousGroupExpiry);
+
+	// Mana/stamina costs, paid from an AttributeComponent (free when there is none)
+	static bool CanAffordCosts(const FSkillSpec& Spec, const UAttributeComponent* Attributes);
+	static bool CommitCosts(const FSkillSpec& Spec, UAttributeComponent* Attributes);
+	static void RefundCosts(const FSkillSpec& Spec, UAttributeComponent* Attributes);
+
+	// True if Target is within the skill's range of Caster (plus Tolerance); skills without range or target always pass
+	static bool IsInRange(const FSkillSpec& Spec, const AActor& Caster, const AActor* Target, float Tolerance = 0.0f);
+
+	// Apply the skill's effects (projectile launch toward Target, or straight ahead)
+	static void Execute(const FSkillSpec& Spec, AActor& Caster, AActor* Target);
+};
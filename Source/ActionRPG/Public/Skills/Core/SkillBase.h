@@ -5,8 +5,17 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "SkillDataAsset.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
 #include "SkillBase.generated.h"
 
+struct FSkillSpec;
+
+/**
+ * Blueprint-facing skill object: one skill (SkillData) bound to one owner.
+ * Rules and data come from the shared FSkillSpec compiled by the Skill Database and FSkillActivation;
+ * the object itself only caches the owner's cooldown handles. Characters use USkillComponent loadouts
+ * instead - create USkillBase objects only where Blueprint needs a skill UObject or an ExecuteSkill override.
+ */
 UCLASS(BlueprintType, Blueprintable)
 class ACTIONRPG_API USkillBase : public UObject
 {
@@ -19,16 +28,36 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
 	TObjectPtr<USkillDataAsset> SkillData;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Skill")
-	float CooldownRemaining;
+	// Actor that owns this skill (cooldowns are tracked per owner)
+	UFUNCTION(BlueprintCallable, Category = "Skill")
+	void SetOwningActor(AActor* NewOwner);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill")
+	AActor* GetOwningActor() const { return OwningActor; }
+
+	// UObject interface - skills resolve their world through the owning actor
+	virtual UWorld* GetWorld() const override;
 
-	// Skill Activation
+	// Skill Activation - owned skills go through the world's cast pipeline (cast time, channel, recovery)
 	UFUNCTION(BlueprintCallable, Category = "Skill", meta = (CallInEditor = "true"))
 	virtual USkillBase* Activate(AActor* Target = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Skill")
 	virtual bool CanActivate(AActor* Target = nullptr) const;
 
+	// Mana/stamina costs, paid from the owning actor's AttributeComponent (free if it has none)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill")
+	bool CanAffordCosts() const;
+
+	// Apply the skill (end of cast time) and broadcast OnSkillActivated
+	virtual void ExecuteSkill(AActor* Target);
+
+	// Shared runtime spec for SkillData (nullptr until the Skill Database has registered it)
+	const FSkillSpec* GetSkillSpec() const;
+
+	// Targeting: characters within SkillData->Range of the owning actor (excluding it), written to OutTargets
+	int32 FindTargetsInRange(TArrayView<class AActionRPGCharacter*> OutTargets) const;
+
 	// Skill Information
 	UFUNCTION(BlueprintCallable, Category = "Skill")
 	FName GetSkillID() const;
@@ -50,4 +79,19 @@ public:
 	
 	UPROPERTY(BlueprintAssignable, Category = "Skill")
 	FOnSkillActivated OnSkillActivated;
+
+protected:
+	UPROPERTY()
+	TObjectPtr<AActor> OwningActor;
+
+	// Object cooldowns are keyed on (owning actor, or the skill itself when unowned)
+	const UObject* GetCooldownOwner() const;
+
+	// Resolve (once) the cooldown slots for this skill's cooldown ID and group
+	void ResolveCooldownHandles(const FSkillSpec& Spec, USkillCooldownSubsystem& Cooldowns) const;
+
+	// Cached cooldown slots - resolving a cached handle is O(1), no hashing
+	mutable FCooldownHandle CooldownHandle;
+	mutable FCooldownHandle GroupCooldownHandle;
+	mutable TWeakObjectPtr<const USkillDataAsset> CooldownHandlesSkillData;
 };
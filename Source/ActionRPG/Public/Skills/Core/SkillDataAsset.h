@@ -48,6 +48,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill", meta = (ClampMin = "0.0"))
 	float CooldownDuration;
 
+	// Skills with the same SharedCooldownID share one cooldown timer. Empty = per SkillID.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cooldown")
+	FName SharedCooldownID;
+
+	// Activating this skill also locks out every skill in the group for CooldownGroupDuration (e.g. a global cooldown)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cooldown")
+	FName CooldownGroup;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Cooldown", meta = (ClampMin = "0.0"))
+	float CooldownGroupDuration;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill", meta = (ClampMin = "0.0"))
 	float ManaCost;
 
@@ -57,6 +68,32 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill", meta = (ClampMin = "0.0"))
 	float CastTime;
 
+	// Time the skill keeps channeling after it executes (0 = no channel)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Casting", meta = (ClampMin = "0.0"))
+	float ChannelDuration;
+
+	// Time the caster stays locked out after the cast/channel ends; a queued skill starts afterwards
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Casting", meta = (ClampMin = "0.0"))
+	float RecoveryTime;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill", meta = (ClampMin = "0.0"))
 	float Range;
+
+	// Projectile launched when the skill executes (0 = no projectile)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Projectile", meta = (ClampMin = "0.0"))
+	float ProjectileSpeed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Projectile", meta = (ClampMin = "0.0"))
+	float ProjectileRadius;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Projectile", meta = (ClampMin = "0.0"))
+	float ProjectileLifetime;
+
+	// Cosmetic actor moved along with the projectile (pooled; its tick and collision are disabled)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|Projectile")
+	TSubclassOf<AActor> ProjectileVisualClass;
+
+	// Dense index assigned by the Skill Database at registration (INDEX_NONE until registered)
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Skill|Runtime")
+	int32 RuntimeIndex;
 };
@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skills/Cooldowns/SkillCooldownSubsystem.h"
+
+/**
+ * Per-owner skill state: which skill sits in each slot plus that slot's cached cooldown handles.
+ * Skills are referenced by spec index (FSkillSpec::SkillIndex), so a loadout holds no UObjects;
+ * up to MaxInlineSlots slots live inline (~200 bytes, no heap allocation).
+ * All activation logic operates on it through FSkillActivation.
+ */
+struct ACTIONRPG_API FSkillLoadout
+{
+	static constexpr int32 MaxInlineSlots = 8;
+
+	void SetNumSlots(int32 NumSlots)
+	{
+		const int32 OldNumSlots = SkillIndices.Num();
+		SkillIndices.SetNum(NumSlots);
+		for (int32 SlotIndex = OldNumSlots; SlotIndex < NumSlots; SlotIndex++)
+		{
+			SkillIndices[SlotIndex] = INDEX_NONE;
+		}
+		CooldownHandles.SetNum(NumSlots);
+		GroupCooldownHandles.SetNum(NumSlots);
+	}
+
+	int32 GetNumSlots() const { return SkillIndices.Num(); }
+
+	// Put a skill (spec index, INDEX_NONE clears) in a slot; the slot's cooldown handles are re-resolved on next use
+	void SetSkill(int32 SlotIndex, int32 SkillIndex)
+	{
+		if (SkillIndices.IsValidIndex(SlotIndex) && SkillIndices[SlotIndex] != SkillIndex)
+		{
+			SkillIndices[SlotIndex] = SkillIndex;
+			CooldownHandles[SlotIndex].Reset();
+			GroupCooldownHandles[SlotIndex].Reset();
+		}
+	}
+
+	int32 GetSkillIndex(int32 SlotIndex) const { return SkillIndices.IsValidIndex(SlotIndex) ? SkillIndices[SlotIndex] : INDEX_NONE; }
+	int32 FindSlot(int32 SkillIndex) const { return SkillIndices.Find(SkillIndex); }
+
+	// Parallel per-slot arrays
+	TArray<int32, TInlineAllocator<MaxInlineSlots>> SkillIndices;
+	TArray<FCooldownHandle, TInlineAllocator<MaxInlineSlots>> CooldownHandles;
+	TArray<FCooldownHandle, TInlineAllocator<MaxInlineSlots>> GroupCooldownHandles;
+};
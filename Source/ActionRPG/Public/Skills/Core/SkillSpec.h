@@ -0,0 +1,50 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skills/Core/SkillTypes.h"
+
+class USkillDataAsset;
+
+/**
+ * Immutable runtime definition of a skill, compiled once from its USkillDataAsset.
+ * One spec exists per registered skill (owned by the Skill Database, indexed by RuntimeIndex)
+ * and is shared by every owner of that skill - per-owner state lives in FSkillLoadout.
+ */
+struct ACTIONRPG_API FSkillSpec
+{
+	// Source asset (kept referenced by the Skill Database)
+	USkillDataAsset* SkillData = nullptr;
+
+	int32 SkillIndex = INDEX_NONE;
+	FName SkillID;
+	ESkillType Type = ESkillType::Utility;
+
+	// Cooldowns (CooldownID is SharedCooldownID if set, otherwise SkillID)
+	FName CooldownID;
+	FName CooldownGroup;
+	float CooldownDuration = 0.0f;
+	float CooldownGroupDuration = 0.0f;
+
+	// Costs
+	float ManaCost = 0.0f;
+	float StaminaCost = 0.0f;
+
+	// Cast pipeline
+	float CastTime = 0.0f;
+	float ChannelDuration = 0.0f;
+	float RecoveryTime = 0.0f;
+	float Range = 0.0f;
+
+	// Projectile (ProjectileSpeed 0 = none)
+	float ProjectileSpeed = 0.0f;
+	float ProjectileRadius = 0.0f;
+	float ProjectileLifetime = 0.0f;
+	UClass* ProjectileVisualClass = nullptr;
+
+	bool IsValid() const { return SkillData != nullptr; }
+	bool HasCosts() const { return ManaCost > 0.0f || StaminaCost > 0.0f; }
+
+	static FSkillSpec FromDataAsset(USkillDataAsset& InSkillData);
+};
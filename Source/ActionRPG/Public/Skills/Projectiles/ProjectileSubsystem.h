@@ -0,0 +1,122 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "ProjectileSubsystem.generated.h"
+
+class USkillDataAsset;
+struct FSkillSpec;
+
+/**
+ * Free visual actors of one class.
+ */
+USTRUCT()
+struct FProjectileVisualPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> FreeActors;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnProjectileHit, AActor*, Owner, AActor*, HitActor, USkillDataAsset*, SkillData, FVector, HitLocation);
+
+/**
+ * Simulates skill projectiles as data.
+ * Projectiles are rows in contiguous arrays (position, velocity, lifetime, radius, owner, skill
+ * index) advanced in one batched update per frame - no actor or component ticks per projectile.
+ *
+ * Collision per frame:
+ * - Characters: segment query against the character spatial hash (synchronous, no physics).
+ * - World geometry: one async sphere sweep per projectile, issued in a batch and resolved the
+ *   following frame (one frame of latency on wall hits).
+ *
+ * Visual actors (optional, per skill) are pooled by class and only have their transform written.
+ * "stat ActionRPG" shows projectile counts and update cost.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the projectile subsystem for the world of the given context object (nullptr if unavailable)
+	static UProjectileSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Launch a projectile for a skill (uses the skill's projectile speed, radius, lifetime and visual)
+	UFUNCTION(BlueprintCallable, Category = "Projectiles")
+	bool SpawnProjectile(AActor* Owner, USkillDataAsset* SkillData, FVector Location, FVector Direction);
+
+	// Same, from a compiled skill spec (activation path - no asset reads)
+	bool LaunchProjectile(AActor* Owner, const FSkillSpec& Spec, const FVector& Location, const FVector& Direction);
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Projectiles")
+	int32 GetNumProjectiles() const { return Positions.Num(); }
+
+	// Fired when a projectile hits a character or world geometry (HitActor may be null for BSP)
+	UPROPERTY(BlueprintAssignable, Category = "Projectiles")
+	FOnProjectileHit OnProjectileHit;
+
+protected:
+	// Hard cap on simultaneous projectiles (spawns beyond it are rejected)
+	UPROPERTY(Config, EditAnywhere, Category = "Projectiles", meta = (ClampMin = "1"))
+	int32 MaxProjectiles = 4096;
+
+	// Upper bound on free visual actors kept per class
+	UPROPERTY(Config, EditAnywhere, Category = "Projectiles", meta = (ClampMin = "0"))
+	int32 MaxPooledVisualsPerClass = 128;
+
+private:
+	struct FPendingHit
+	{
+		int32 ProjectileIndex = INDEX_NONE;
+		TWeakObjectPtr<AActor> HitActor;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	// Resolve last frame's geometry sweeps; records hits
+	void ResolveGeometrySweeps(UWorld& World);
+
+	// Move every projectile, test character hits, issue this frame's geometry sweeps
+	void Integrate(UWorld& World, float DeltaTime);
+
+	// Broadcast hits and remove hit/expired projectiles
+	void FlushHitsAndExpired();
+
+	void WriteVisualTransforms();
+
+	void RemoveProjectileAt(int32 Index);
+
+	AActor* AcquireVisual(UWorld& World, TSubclassOf<AActor> VisualClass, const FVector& Location, const FRotator& Rotation);
+	void ReleaseVisual(AActor* Visual);
+
+	// Projectile rows (structure of arrays, swap-removed)
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> RemainingLifetimes;
+	TArray<float> Radii;
+	TArray<TWeakObjectPtr<AActor>> Owners;
+	TArray<int32> SkillIndices;
+	TArray<FTraceHandle> PendingSweeps;
+	TArray<uint8> PendingRemoval;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> Visuals;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FProjectileVisualPool> VisualPools;
+
+	// Scratch, reused every frame
+	TArray<FPendingHit> PendingHits;
+};
@@ -0,0 +1,69 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "StatusEffectDataAsset.generated.h"
+
+/**
+ * Data Asset defining a buff or debuff.
+ * An effect can tick an attribute periodically (damage/heal over time), modify an attribute's
+ * max value or regen rate while active, or both. Referenced directly by items and skills;
+ * the Status Effect Subsystem compiles it the first time it is applied.
+ */
+UCLASS(BlueprintType)
+class ACTIONRPG_API UStatusEffectDataAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UStatusEffectDataAsset();
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect")
+	FName EffectID;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect")
+	FText DisplayName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect")
+	TObjectPtr<UTexture2D> Icon;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect")
+	bool bIsDebuff;
+
+	// Seconds the effect lasts (0 = until removed). Re-applying refreshes it.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect", meta = (ClampMin = "0.0"))
+	float Duration;
+
+	// Re-applying adds stacks up to this count; periodic and modifier magnitudes scale with stacks
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect", meta = (ClampMin = "1"))
+	int32 MaxStacks;
+
+	// Periodic: every Period seconds, add PeriodicMagnitude (per stack) to PeriodicAttribute. Negative values damage.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Periodic")
+	EActionRPGAttribute PeriodicAttribute;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Periodic")
+	float PeriodicMagnitude;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Periodic", meta = (ClampMin = "0.0"))
+	float Period;
+
+	// Modifier held while the effect is active (0 magnitude = none)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Modifier")
+	EActionRPGAttribute ModifierAttribute;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Modifier")
+	EAttributeModifierTarget ModifierTarget;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Modifier")
+	EAttributeModifierOp ModifierOp;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Status Effect|Modifier")
+	float ModifierMagnitude;
+
+	bool IsPeriodic() const { return Period > 0.0f && PeriodicMagnitude != 0.0f; }
+	bool HasModifier() const { return ModifierMagnitude != 0.0f; }
+};
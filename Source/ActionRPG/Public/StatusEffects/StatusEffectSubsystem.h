@@ -0,0 +1,188 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/Attributes/AttributeComponent.h"
+#include "StatusEffectSubsystem.generated.h"
+
+class UStatusEffectDataAsset;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnStatusEffectChanged, AActor*, Target, UStatusEffectDataAsset*, Effect, int32, Stacks);
+
+/**
+ * Runs every active buff/debuff in the world.
+ * Active effects are rows in contiguous arrays (target, effect index, expiry, stacks, next
+ * periodic tick). Once per frame:
+ * 1. Update pass - periodic ticks due and expirations are computed for every row, split into
+ *    chunks run with ParallelFor. Rows only write their own outputs; no UObject is touched.
+ * 2. Commit - on the game thread, periodic deltas are summed per target and attribute and
+ *    applied with one ModifyValue each, then expired rows are removed.
+ * Frames in which no row has an event due skip both passes, so a target's rows are dropped when
+ * it ends play rather than waiting for the next commit.
+ * "stat ActionRPG" shows effect counts and update cost.
+ */
+UCLASS(Config = Game)
+class ACTIONRPG_API UStatusEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Get the status effect subsystem for the world of the given context object (nullptr if unavailable)
+	static UStatusEffectSubsystem* Get(const UObject* WorldContextObject);
+
+	// Subsystem lifecycle
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Apply an effect (or add stacks and refresh its duration if the target already has it)
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	bool ApplyStatusEffect(AActor* Target, UStatusEffectDataAsset* Effect, int32 Stacks = 1);
+
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	bool RemoveStatusEffect(AActor* Target, UStatusEffectDataAsset* Effect);
+
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	void RemoveAllStatusEffects(AActor* Target);
+
+	// Queries
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Status Effects")
+	int32 GetStatusEffectStacks(const AActor* Target, const UStatusEffectDataAsset* Effect) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Status Effects")
+	bool HasStatusEffect(const AActor* Target, const UStatusEffectDataAsset* Effect) const { return GetStatusEffectStacks(Target, Effect) > 0; }
+
+	// Seconds until the effect expires (0 if absent, -1 if it never expires)
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Status Effects")
+	float GetStatusEffectTimeRemaining(const AActor* Target, const UStatusEffectDataAsset* Effect) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Status Effects")
+	TArray<UStatusEffectDataAsset*> GetStatusEffects(const AActor* Target) const;
+
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Status Effects")
+	int32 GetNumActiveEffects() const { return RowTargets.Num(); }
+
+	// Events (Stacks is 0 on removal)
+	UPROPERTY(BlueprintAssignable, Category = "Status Effects")
+	FOnStatusEffectChanged OnStatusEffectApplied;
+
+	UPROPERTY(BlueprintAssignable, Category = "Status Effects")
+	FOnStatusEffectChanged OnStatusEffectRemoved;
+
+protected:
+	// Rows per ParallelFor task in the update pass
+	UPROPERTY(Config, EditAnywhere, Category = "Status Effects", meta = (ClampMin = "64"))
+	int32 RowsPerTask = 1024;
+
+	// Below this many rows the update pass runs on the game thread (task overhead would dominate)
+	UPROPERTY(Config, EditAnywhere, Category = "Status Effects", meta = (ClampMin = "0"))
+	int32 MinRowsForParallelUpdate = 2048;
+
+private:
+	static constexpr int32 NumAttributes = static_cast<int32>(EActionRPGAttribute::Count);
+
+	// Effect definition, compiled from its data asset on first use
+	struct FCompiledStatusEffect
+	{
+		float Duration = 0.0f;
+		int32 MaxStacks = 1;
+		int32 PeriodicAttribute = 0;
+		float PeriodicMagnitude = 0.0f;
+		double Period = 0.0;
+		EActionRPGAttribute ModifierAttribute = EActionRPGAttribute::Health;
+		EAttributeModifierTarget ModifierTarget = EAttributeModifierTarget::MaxValue;
+		EAttributeModifierOp ModifierOp = EAttributeModifierOp::Additive;
+		float ModifierMagnitude = 0.0f;
+	};
+
+	// Actor carrying at least one effect
+	struct FStatusEffectTarget
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UAttributeComponent> Attributes;
+		FObjectKey ActorKey;
+
+		// Rows of this target's effects
+		TArray<int32, TInlineAllocator<8>> Rows;
+
+		// Periodic deltas summed during the commit
+		float PendingDeltas[NumAttributes] = {};
+		bool bHasPendingDeltas = false;
+		bool bInUse = false;
+
+		// Ended play during a commit; its rows are removed at the end of that commit
+		bool bEndedPlay = false;
+	};
+
+	struct FPendingRemoval
+	{
+		TWeakObjectPtr<AActor> Target;
+		int32 DefinitionIndex = INDEX_NONE;
+	};
+
+	int32 FindOrAddDefinition(UStatusEffectDataAsset& Effect);
+	int32 FindDefinition(const UStatusEffectDataAsset* Effect) const;
+
+	int32 FindOrAddTarget(AActor& Actor);
+	int32 FindTarget(const AActor* Actor) const;
+	void ReleaseTarget(int32 TargetIndex);
+
+	// Bound to OnEndPlay of every target - a dead or unloaded actor takes its rows with it
+	UFUNCTION()
+	void HandleTargetEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	// Row of a target's effect (INDEX_NONE if absent)
+	int32 FindRow(int32 TargetIndex, int32 DefinitionIndex) const;
+
+	// (Re)apply a row's attribute modifier for its current stack count
+	void UpdateRowModifier(int32 Row);
+
+	void RemoveRow(int32 Row);
+
+	// Per-row periodic ticks and expirations (worker threads)
+	void RunUpdatePass(double Now);
+
+	// Apply periodic deltas and remove expired rows (game thread)
+	void CommitUpdatePass();
+
+	double GetEffectTime() const;
+
+	// Compiled definitions, indexed by definition index (local to this subsystem, like the row and
+	// target indexes - anything replicated or saved must refer to the effect asset instead)
+	UPROPERTY()
+	TArray<TObjectPtr<UStatusEffectDataAsset>> DefinitionAssets;
+
+	TArray<FCompiledStatusEffect> Definitions;
+	TMap<FObjectKey, int32> DefinitionLookup;
+
+	TArray<FStatusEffectTarget> Targets;
+	TArray<int32> FreeTargets;
+	TMap<FObjectKey, int32> TargetLookup;
+
+	// Active effect rows (structure of arrays, swap-removed)
+	TArray<int32> RowTargets;
+	TArray<int32> RowDefinitions;
+	TArray<double> RowExpiryTimes;
+	TArray<double> RowNextTickTimes;
+	TArray<int32> RowStacks;
+	TArray<FAttributeModifierHandle> RowModifiers;
+
+	// Update pass outputs, parallel to the rows
+	TArray<int32> RowTickCounts;
+	TArray<uint8> RowExpired;
+
+	// Earliest expiry/periodic tick of any row; frames before it skip the update
+	double NextEventTime = TNumericLimits<double>::Max();
+
+	// Set while CommitUpdatePass applies deltas (which can kill and destroy targets)
+	bool bCommitting = false;
+
+	// Scratch, reused every frame
+	TArray<int32> CommitTargets;
+	TArray<FPendingRemoval> PendingRemovals;
+};
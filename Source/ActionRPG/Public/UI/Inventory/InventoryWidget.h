@@ -146,6 +146,9 @@ protected:
 	UFUNCTION()
 	void OnItemAdded(UItemBase* Item);
 
+	UFUNCTION()
+	void OnInventoryBulkChanged(const TArray<int32>& SlotIndices);
+
 	UFUNCTION()
 	void OnItemRemoved(UItemBase* Item, int32 Quantity);
 
@@ -64,6 +64,9 @@ protected:
 	UFUNCTION()
 	void OnInventoryChangedInternal(int32 SlotIndex, UItemBase* Item);
 
+	UFUNCTION()
+	void OnInventoryBulkChangedInternal(const TArray<int32>& SlotIndices);
+
 private:
 	UPROPERTY()
 	TArray<TObjectPtr<UQuickUseSlotWidget>> SlotWidgets;